@@ -0,0 +1,309 @@
+grammar Caramel;
+r
+  : statements EOF
+  ;
+
+// Program statements
+statements
+  : statement+
+  ;
+statement
+  : instruction
+  | declaration
+  | InstructionSeparator
+  ;
+
+instructions
+  : instruction+
+  ;
+instruction
+  : jump InstructionSeparator+
+  | controlBlock
+  | expression InstructionSeparator+
+  ;
+
+declarations
+  : declaration+
+  ;
+
+declaration
+  : typeDefinition InstructionSeparator+
+  | functionDefinition
+  | functionDeclaration InstructionSeparator+
+  | arrayDeclaration InstructionSeparator+
+  | arrayDefinition InstructionSeparator+
+  | variableDeclaration InstructionSeparator+
+  | variableDefinition InstructionSeparator+
+  ;
+
+// Declarations
+typeDefinition
+  : 'typedef' typeParameter typeParameter
+  ;
+
+functionDeclarationInner
+  : typeParameter validIdentifier functionArguments
+  ;
+functionDeclaration
+  : functionDeclarationInner
+  ;
+functionDefinition
+  : functionDeclarationInner block ;
+
+variableDeclaration
+  : 'extern' typeParameter validIdentifier (Comma_ validIdentifier)*
+  ;
+variableDefinition
+  : typeParameter (variableDefinitionAssignment|validIdentifier) (Comma_ (variableDefinitionAssignment|validIdentifier))*
+  ;
+variableDefinitionAssignment
+  : validIdentifier Assignment_ expressionNoComma ;
+
+arrayUnsizedInner
+  : typeParameter validIdentifier L_Bracket_ R_Bracket_
+  ;
+arraySizedInner
+  : typeParameter validIdentifier L_Bracket_ positiveConstant R_Bracket_
+  ;
+arraySize
+  : L_Bracket_ positiveConstant R_Bracket_
+  ;
+arrayDeclaration
+  : 'extern' (arrayUnsizedInner | arraySizedInner)
+  ;
+arrayDefinition
+  : arrayUnsizedInner assignmentOperator arrayBlock
+  | arraySizedInner (assignmentOperator arrayBlock)?
+  ;
+
+// Jump instructions
+jump
+  : breakJump
+  | returnJump
+  ;
+returnJump
+  : ReturnKeyword_ expression?
+  ;
+breakJump : BreakKeyword_ ;
+
+// Control block
+controlBlock
+  : ifBlock
+  | whileBlock
+  | doWhileBlock
+  | forBlock
+  ;
+
+ifBlock
+  : IfKeyword_ L_Par_ expression R_Par_ block (ElseKeyword_ (ifBlock|block))?
+  ;
+whileBlock
+  : WhileKeyWord_ L_Par_ expression R_Par_ block
+  ;
+doWhileBlock
+  : DoKeyWord_ block WhileKeyWord_ L_Par_ expression R_Par_ Semilicon_
+  ;
+forBlock
+  : ForKeyword_ L_Par_
+      expression Semilicon_
+      expression Semilicon_
+      expression R_Par_
+      block
+  ;
+
+// Blocks
+block
+  : L_CBracket_ declarations? instructions? R_CBracket_
+  ;
+
+arrayBlock
+  : L_CBracket_ R_CBracket_
+  | L_CBracket_ expressionNoComma (Comma_ expressionNoComma)* Comma_? R_CBracket_
+  ;
+
+// Function definition helpers
+functionArguments
+  : L_Par_ R_Par_
+  | L_Par_ functionArgument (Comma_ functionArgument)* Comma_? R_Par_
+  ;
+functionArgument
+  : typeParameter validIdentifier? (functionArgumentArraySuffix)?
+  ;
+functionArgumentArraySuffix
+  : '[' (expressionNoComma)? ']'
+  ;
+
+// Type & identifiers
+typeParameter
+  : Identifier ;
+validIdentifier
+  : Identifier ;
+
+// Left & Right values
+lvalue
+  : validIdentifier arrayAccess?
+  ;
+atomicExpression // As right value
+  : L_Par_ expression R_Par_ // '(' e ')'
+  | numberConstant
+  | charConstant
+  | lvalue
+  | validIdentifier callSufix
+  ;
+callSufix
+  : L_Par_ R_Par_
+  | L_Par_ expressionNoComma (Comma_ expressionNoComma)* Comma_? R_Par_
+  ;
+arrayAccess
+  : L_Bracket_ expression R_Bracket_
+  ;
+
+expression
+  : expressionNoComma (Comma_ expressionNoComma)*
+  ;
+
+// Binary expressions, from the highest to the lowest precedence
+expressionNoComma
+  : prefixUnaryExpression
+  | expressionNoComma op=( Times_ | Div_ | Mod_ ) expressionNoComma
+  | expressionNoComma op=( Plus_ | Minus_ ) expressionNoComma
+  | expressionNoComma op=( RightShiftOp_ | LeftShiftOp_ ) expressionNoComma
+  | expressionNoComma op=( LowerThan_ | LowerEqThan_ | GreaterThan_ | GreaterEqThan_ ) expressionNoComma
+  | expressionNoComma op=( EqualityOp_ | DiffOp_ ) expressionNoComma
+  | expressionNoComma op=BitwiseAnd_ expressionNoComma
+  | expressionNoComma op=BitwiseXor_ expressionNoComma
+  | expressionNoComma op=BitwiseOr_ expressionNoComma
+  | expressionNoComma op=AndOp_ expressionNoComma
+  | expressionNoComma op=OrOp_ expressionNoComma
+  | lvalue assignmentOperator expressionNoComma
+  ;
+
+prefixUnaryExpression
+  : prefixUnaryOperator? postfixUnaryExpression
+  ;
+postfixUnaryExpression
+  : atomicExpression postfixUnaryOperation?
+  ;
+
+// Operators
+postfixUnaryOperator : ( IncOp_ | DecOp_ ) ;
+prefixUnaryOperator : ( Minus_ | IncOp_ | DecOp_ | LogicalNot_ | BitwiseNot_ | cast) ;
+assignmentOperator : ( Assignment_ | PlusAssign_ | MinusAssign_ | TimesAssign_ | DivAssign_ | ModAssign_ | BitwiseAndAssign_ | BitwiseOrAssign_ | BitwiseXorAssign_ | BitwiseNotAssign_ | LeftShiftAssign_ | RightShiftAssign_ ) ;
+
+postfixUnaryOperation
+  : postfixUnaryOperator
+  ;
+
+cast
+  : L_Par_ typeParameter R_Par_
+  ;
+
+// Constants
+numberConstant
+  : PositiveNumber
+  | Minus_ PositiveNumber
+  ;
+positiveConstant : PositiveNumber;
+charConstant
+  : CharacterLiteral
+  | EscapedZero_
+  | EscapedNL_
+  | EscapedCR_
+  | EscapedTB_
+  | EscapedInterro_
+  | EscapedSimpeQuote_
+  | EscapedDoubleQuote_
+  | EscapedAntibackslash_
+  ;
+
+InstructionSeparator : Semilicon_ ;
+CharacterLiteral : '\'' ~['\\\r\n] '\'' ;
+PositiveNumber : FragmentNumber_;
+Identifier : FragmentIdentifier_ ;
+
+// Ignored blocks
+BlockComment
+    : '/*' .*? '*/' -> skip ;
+LineComment
+    : '//' ~[\r\n]* -> skip ;
+Macro
+    : '#' ~[\r\n]* -> skip ;
+WS
+    : WS_ -> skip ;
+
+
+// Do not delete the following comment line
+// InjectedTokens
+NewLine_ : '\\n' ;
+FragmentNumber_ : Digit_+;
+Digit_ : ('0'|'1'|'2'|'3'|'4'|'5'|'6'|'7'|'8'|'9') ;
+LowerCaseLetter_ : ('a'|'b'|'c'|'d'|'e'|'f'|'g'|'h'|'i'|'j'|'k'|'l'|'m'|'n'|'o'|'p'|'q'|'r'|'s'|'t'|'u'|'v'|'w'|'x'|'y'|'z') ;
+UpperCaseLetter_ : ('A'|'B'|'C'|'D'|'E'|'F'|'G'|'H'|'I'|'J'|'K'|'L'|'M'|'N'|'O'|'P'|'Q'|'R'|'S'|'T'|'U'|'V'|'W'|'X'|'Y'|'Z') ;
+Underscore_ : '_' ;
+DigitSeparator_ : '.' ;
+CarryReturn_ : '\\r' ;
+Tab_ : '\\t' ;
+Space_ : ' ' ;
+InlineWS_ : ( Space_ | Tab_ | CarryReturn_ );
+WS_ : ( InlineWS_ | NewLine_ );
+PlusAssign_ : '+=' ;
+MinusAssign_ : '-=' ;
+TimesAssign_ : '*=' ;
+DivAssign_ : '/=' ;
+ModAssign_ : '%=' ;
+BitwiseOrAssign_ : '|=' ;
+BitwiseXorAssign_ : '^=' ;
+BitwiseAndAssign_ : '&=' ;
+BitwiseNotAssign_ : '~=' ;
+RightShiftAssign_ : '>>=' ;
+LeftShiftAssign_ : '<<=' ;
+Plus_ : '+' ;
+Minus_ : '-' ;
+Times_ : '*' ;
+Div_ : '/' ;
+Mod_ : '%' ;
+IncOp_ : '++' ;
+DecOp_ : '--' ;
+L_Par_ : '(' ;
+R_Par_ : ')' ;
+L_CBracket_ : '{' ;
+R_CBracket_ : '}' ;
+L_Bracket_ : '[' ;
+R_Bracket_ : ']' ;
+LowerThan_ : '<' ;
+GreaterThan_ : '>' ;
+LowerEqThan_ : '<=' ;
+GreaterEqThan_ : '>=' ;
+EqualityOp_ : '==' ;
+RefEqualityOp_ : '===' ;
+DiffOp_ : '!=' ;
+Letter_ : ( LowerCaseLetter_ | UpperCaseLetter_ ) ;
+FragmentIdentifier_ : ( Underscore_ | Underscore_? Letter_ AnyCharacter_* ) ;
+AnyCharacter_ : ( Underscore_ | Letter_ | Digit_ ) ;
+Assignment_ : '=' ;
+Comma_ : ',' ;
+EscapedZero_ : '\'\\\\0\'';
+EscapedNL_ : '\'\\\\n\'';
+EscapedCR_ : '\'\\\\r\'';
+EscapedTB_ : '\'\\\\t\'';
+EscapedInterro_ : '\'?\'';
+EscapedSimpeQuote_ : '\'\\\\\'\'';
+EscapedDoubleQuote_ : '\'\\\\"\'';
+EscapedAntibackslash_ : '\'\\\\\\\\\'';
+Semilicon_ : ';' ;
+LogicalNot_ : '!' ;
+AndOp_ : '&&' ;
+OrOp_ : '||' ;
+IfKeyword_ : 'if' ;
+ForKeyword_ : 'for' ;
+WhileKeyWord_ : 'while' ;
+DoKeyWord_ : 'do' ;
+ElseKeyword_ : 'else' ;
+ReturnKeyword_ : 'return' ;
+BreakKeyword_ : 'break' ;
+RightShiftOp_ : '>>' ;
+LeftShiftOp_ : '<<' ;
+BitwiseAnd_ : '&' ;
+BitwiseOr_ : '|';
+BitwiseXor_ : '^' ;
+BitwiseNot_ : '~' ;
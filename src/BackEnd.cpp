@@ -29,20 +29,25 @@
 
 namespace caramel {
 
-void BackEnd::generateAssembly(
-        std::string const &filePath,
-        std::shared_ptr<ast::Context> context,
-        std::ostream &os,
-        caramel::ir::CFGVisitor::Ptr const &cfgVisitor
+ir::CFG::Ptr BackEnd::buildControlFlowGraph(
+        Config const &config,
+        std::shared_ptr<ast::Context> context
 ) {
-    std::vector<std::string> pathParts = splitPath(filePath);
-    std::shared_ptr<ir::CFG> cfg = std::make_shared<ir::CFG>(
-            pathParts.back(), context
+    std::vector<std::string> pathParts = splitPath(config.sourceFile);
+    ir::CFG::Ptr cfg = std::make_shared<ir::CFG>(
+            pathParts.back(), context, config
     );
 
-    cfgVisitor->generateAssembly(cfg, os);
+    CARAMEL_DEBUG << *cfg;
+    return cfg;
+}
 
-    logger.debug() << *cfg;
+void BackEnd::generateAssembly(
+        ir::CFG::Ptr const &controlFlowGraph,
+        std::ostream &os,
+        caramel::ir::CFGVisitor::Ptr const &cfgVisitor
+) {
+    cfgVisitor->generateAssembly(controlFlowGraph, os);
 }
 
 std::vector<std::string> BackEnd::splitPath(std::string const &s, char delimiter) {
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include "Config.h"
 #include "ast/context/Context.h"
 #include "ir/CFGVisitor.h"
 
@@ -32,9 +33,16 @@ namespace caramel {
 
 class BackEnd {
 public:
+    /**
+     * Lowers the AST into a CFG. Build it once, and give it to every CFGVisitor.
+     */
+    static std::shared_ptr<ir::CFG> buildControlFlowGraph(
+            Config const &config,
+            std::shared_ptr<ast::Context> context
+    );
+
     static void generateAssembly(
-            std::string const &filePath,
-            std::shared_ptr<ast::Context> context,
+            std::shared_ptr<ir::CFG> const &controlFlowGraph,
             std::ostream &os,
             std::shared_ptr<ir::CFGVisitor> const &cfgVisitor
     );
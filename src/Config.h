@@ -37,6 +37,11 @@ struct Config {
     bool syntaxTreeDot = false;
     bool astDot = false;
     bool irDot = false;
+    bool handwrittenParser = false;
+    size_t errorLimit = 20; // 0 for no limit
+    bool targetAvx2 = false;
+    size_t unrollFactor = 0; // 0 for the heuristic, 1 to disable
+    size_t jobs = 0; // 0 for one thread per core
     std::string sourceFile;
     LoggerLevel verbosity = INFO;
 };
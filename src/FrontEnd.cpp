@@ -26,33 +26,103 @@
 
 #include "Logger.h"
 #include "ast/context/Context.h"
-#include "utils/SourceFileUtil.h"
+#include "utils/Diagnostics.h"
 #include "exceptions/SemanticError.h"
 #include "listeners/errorlistener/ParserErrorListener.h"
+#include "parser/Parser.h"
+#include "parser/SourceCharStream.h"
 
 
 namespace caramel {
 
-ast::Context::Ptr frontEnd(Config const &config) {
-    CARAMEL_UNUSED(config);
+// Parse with the cheap SLL prediction first, and only pay for full LL when SLL fails.
+// SLL succeeds on nearly all correct inputs, and full LL gives the exact syntax errors otherwise, recovering after each.
+static CaramelParser::RContext *parseSource(
+        CaramelParser &parser,
+        CommonTokenStream &tokens,
+        listeners::ParserErrorListener &errorListener
+) {
+    auto interpreter = parser.getInterpreter<atn::ParserATNSimulator>();
+
+    interpreter->setPredictionMode(atn::PredictionMode::SLL);
+    parser.removeErrorListeners();
+    parser.setErrorHandler(std::make_shared<BailErrorStrategy>());
+    try {
+        return parser.r();
+    } catch (ParseCancellationException &) {
+        logger.debug() << "SLL parsing failed, retrying with full LL.";
+    }
+
+    tokens.seek(0);
+    parser.reset();
+    interpreter->setPredictionMode(atn::PredictionMode::LL);
+    parser.addErrorListener(&errorListener);
+    parser.setErrorHandler(std::make_shared<DefaultErrorStrategy>());
+    return parser.r();
+}
+
+// Reports the collected errors and exits if there are any, and generates the dot of the AST if asked.
+static ast::Context::Ptr checkAst(Config const &config, utils::Diagnostics const &diagnostics, ast::Context::Ptr context) {
+    if (diagnostics.hasErrors()) {
+        diagnostics.report();
+        exit(1);
+    }
+
+    // Generate the dot of the ast if asked
+    if (config.astDot) {
+        // Write the dot file to disc
+        ofstream out;
+        out.open("ast.dot");
+        out << context->getDotFile();
+        out.close();
+
+        // Generate the PDF
+        // TODO: Dirty, change this.
+        system("dot -T pdf -o ast.pdf ast.dot");
+    }
+
+    return context;
+}
 
-    // Read the source file
-    ifstream sourceFile(config.sourceFile);
+// The hand-written front-end builds the AST straight from the tokens, without a syntax tree.
+static ast::Context::Ptr handwrittenFrontEnd(
+        Config const &config,
+        utils::SourceFile::Ptr const &sourceFile,
+        utils::Diagnostics::Ptr const &diagnostics
+) {
+    if (config.syntaxTreeDot) {
+        logger.warning() << "The hand-written parser builds no syntax tree, ignoring --syntax-tree-dot.";
+    }
 
-    // All the Antlr stuff
-    ANTLRInputStream input(sourceFile);
+    parser::Parser parser(sourceFile, diagnostics);
+    return parser.parse();
+}
+
+// Parses with Antlr and visits the syntax tree to build the AST.
+static ast::Context::Ptr antlrFrontEnd(
+        Config const &config,
+        utils::SourceFile::Ptr const &sourceFile,
+        utils::Diagnostics::Ptr const &diagnostics
+) {
+    // Lexes straight from the mapped file, like the hand-written parser
+    parser::SourceCharStream input(sourceFile);
     CaramelLexer lexer(&input);
     CommonTokenStream tokens(&lexer);
     CaramelParser parser(&tokens);
 
-    listeners::ParserErrorListener errorListener(config.sourceFile);
-    parser.removeErrorListeners();
-    parser.addErrorListener(&errorListener);
+    listeners::ParserErrorListener errorListener(diagnostics);
+    CaramelParser::RContext *parseTree = parseSource(parser, tokens, errorListener);
+
+    // The visitor expects a valid syntax tree, the semantic errors wait for the syntax ones to be fixed
+    if (diagnostics->getSyntaxErrorCount() > 0) {
+        diagnostics->report();
+        exit(1);
+    }
 
     // Generate the dot of the syntax tree if asked
     if (config.syntaxTreeDot) {
         Listeners::DotExportListener dotExport(&parser);
-        tree::ParseTreeWalker::DEFAULT.walk(&dotExport, parser.r());
+        tree::ParseTreeWalker::DEFAULT.walk(&dotExport, parseTree);
 
         // Write the dot file to disc
         ofstream out;
@@ -69,45 +139,30 @@ ast::Context::Ptr frontEnd(Config const &config) {
     }
 
     // Create the visitor which will generate the AST
-    try {
-        caramel::visitors::ASTVisitor abstractSyntaxTreeVisitor(config.sourceFile);
-        auto visitorResult = abstractSyntaxTreeVisitor.visit(parser.r());
-
-        int count = abstractSyntaxTreeVisitor.getErrorCount();
-        if (count == 1) {
-            logger.fatal() << "There was one semantic error.";
-            exit(1);
-        } else if (count > 1) {
-            logger.fatal() << "There were " << count << " semantic errors.";
-            exit(1);
-        }
-        if (!visitorResult.is<ast::Context::Ptr>()) {
-            logger.fatal() << "The visitor returned a bad root.";
-            exit(1);
-        }
-
-        // The AST root
-        auto context = visitorResult.as<ast::Context::Ptr>();
-
-        // Generate the dot of the ast if asked
-        if (config.astDot) {
-            // Write the dot file to disc
-            ofstream out;
-            out.open("ast.dot");
-            out << context->getDotFile();
-            out.close();
-
-            // Generate the PDF
-            // TODO: Dirty, change this.
-            system("dot -T pdf -o ast.pdf ast.dot");
-        }
-
-        return context;
+    caramel::visitors::ASTVisitor abstractSyntaxTreeVisitor(diagnostics, parser.getVocabulary());
+    return abstractSyntaxTreeVisitor.visitR(parseTree);
+}
 
+ast::Context::Ptr frontEnd(Config const &config) {
+    // Map the source file once, the lexers and the diagnostics all read from the mapping
+    auto sourceFile = std::make_shared<utils::SourceFile>(config.sourceFile);
+    auto diagnostics = std::make_shared<utils::Diagnostics>(sourceFile, config.errorLimit);
+
+    // The tokens and the syntax tree are freed when the parser building the AST returns,
+    // the AST and the semantic errors only keep their source locations.
+    ast::Context::Ptr context;
+    try {
+        context = config.handwrittenParser
+                  ? handwrittenFrontEnd(config, sourceFile, diagnostics)
+                  : antlrFrontEnd(config, sourceFile, diagnostics);
     } catch (caramel::exceptions::SemanticError &semanticError) {
-        semanticError.explain(utils::SourceFileUtil(config.sourceFile));
+        diagnostics->semanticError(semanticError);
+        diagnostics->report();
         exit(1);
     }
+
+    // The AST root
+    return checkAst(config, *diagnostics, context);
 }
 
 } // namespace Caramel
@@ -43,72 +43,67 @@ void Logger::setLevel(LoggerLevel level) {
     mLevel = level;
 }
 
-Logger::Fatal Logger::Logger::fatal() {
-    return Logger::Fatal(*this);
-}
-
-Logger::Warning Logger::warning() {
-    return Logger::Warning(*this);
-}
-
-Logger::Info Logger::info() {
-    return Logger::Info(*this);
-}
-
-Logger::Debug Logger::debug() {
-    return Logger::Debug(*this);
-}
-
-Logger::Trace Logger::trace() {
-    return Logger::Trace(*this);
-}
-
 void Logger::Fatal::show() {
     using namespace caramel::colors;
-    auto message = mLoggedStream.str();
-    if (mLogger.getLevel() >= FATAL && !message.empty()) {
+    if (!mLoggedStream) {
+        return;
+    }
+    auto message = mLoggedStream->str();
+    if (!message.empty()) {
         std::cerr << red << bold << "[FATAL]" << reset << ' '
                   << red << message << reset << std::endl;
     }
-    mLoggedStream.str(std::string());
+    mLoggedStream->str(std::string());
 }
 
 void Logger::Warning::show() {
     using namespace caramel::colors;
-    auto message = mLoggedStream.str();
-    if (mLogger.getLevel() >= WARN && !message.empty()) {
+    if (!mLoggedStream) {
+        return;
+    }
+    auto message = mLoggedStream->str();
+    if (!message.empty()) {
         std::cerr << yellow << bold << "[WARNING]" << reset << ' '
                   << yellow << message << reset << std::endl;
     }
-    mLoggedStream.str(std::string());
+    mLoggedStream->str(std::string());
 }
 
 void Logger::Info::show() {
     using namespace caramel::colors;
-    auto message = mLoggedStream.str();
-    if (mLogger.getLevel() >= INFO && !message.empty()) {
+    if (!mLoggedStream) {
+        return;
+    }
+    auto message = mLoggedStream->str();
+    if (!message.empty()) {
         std::cerr << blue << bold << "[INFO]" << reset << ' '
                   << blue << message << std::endl;
     }
-    mLoggedStream.str(std::string());
+    mLoggedStream->str(std::string());
 }
 
 void Logger::Debug::show() {
     using namespace caramel::colors;
-    auto message = mLoggedStream.str();
-    if (mLogger.getLevel() >= DEBUG && !message.empty()) {
+    if (!mLoggedStream) {
+        return;
+    }
+    auto message = mLoggedStream->str();
+    if (!message.empty()) {
         std::cerr << cyan << bold << "[DEBUG]" << reset << ' '
                   << cyan << message << std::endl;
     }
-    mLoggedStream.str(std::string());
+    mLoggedStream->str(std::string());
 }
 
 void Logger::Trace::show() {
     using namespace caramel::colors;
-    auto message = mLoggedStream.str();
-    if (mLogger.getLevel() >= TRACE && !message.empty()) {
+    if (!mLoggedStream) {
+        return;
+    }
+    auto message = mLoggedStream->str();
+    if (!message.empty()) {
         std::cerr << magenta << bold << "[TRACE]" << reset << ' '
                   << magenta << message << reset << std::endl;
     }
-    mLoggedStream.str(std::string());
+    mLoggedStream->str(std::string());
 }
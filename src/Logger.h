@@ -27,6 +27,7 @@
 #include <ostream>
 #include <sstream>
 #include <iostream>
+#include <optional>
 
 
 enum LoggerLevel : unsigned int {
@@ -38,24 +39,34 @@ enum LoggerLevel : unsigned int {
     TRACE = 6,
 };
 
+// Levels above this one are compiled out. Set by the CARAMEL_MAX_LOG_LEVEL CMake option.
+#ifndef CARAMEL_MAX_LOG_LEVEL
+#define CARAMEL_MAX_LOG_LEVEL TRACE
+#endif
+
 class Logger : public std::ostream {
 public:
+// The stream is only constructed when the level is enabled, so disabled logs cost a comparison
 #define INNER_LOGGER(name, level)                                       \
     class name final {                                                  \
     public:                                                             \
-        explicit name(Logger& logger) : mLogger(logger) {}              \
+        explicit name(Logger& logger) : mLogger(logger) {               \
+            if (mLogger.isEnabled(level)) {                             \
+                mLoggedStream.emplace();                                \
+            }                                                           \
+        }                                                               \
         ~name() { show(); }                                             \
         void show();                                                    \
         template<typename T>                                            \
         name &operator<<(T const &toLog) {                              \
-            if (mLogger.getLevel() >= level) {                          \
-                mLoggedStream << toLog;                                 \
+            if (mLoggedStream) {                                        \
+                *mLoggedStream << toLog;                                \
             }                                                           \
             return *this;                                               \
         }                                                               \
     protected:                                                          \
         Logger &mLogger;                                                \
-        std::stringstream mLoggedStream;                                \
+        std::optional<std::stringstream> mLoggedStream;                 \
     };
 
     INNER_LOGGER(Fatal, FATAL) // The Fatal logger
@@ -71,14 +82,23 @@ public:
 
     void setLevel(LoggerLevel level);
 
-    Fatal fatal();
-    Warning warning();
-    Info info();
-    Debug debug();
-    Trace trace();
+    inline bool isEnabled(LoggerLevel level) const {
+        return level <= CARAMEL_MAX_LOG_LEVEL && mLevel >= level;
+    }
+
+    inline Fatal fatal() { return Fatal(*this); }
+    inline Warning warning() { return Warning(*this); }
+    inline Info info() { return Info(*this); }
+    inline Debug debug() { return Debug(*this); }
+    inline Trace trace() { return Trace(*this); }
 
 private:
     LoggerLevel mLevel;
 };
 
 extern Logger logger;
+
+// Same as logger.trace() and logger.debug(), but the logged expressions aren't even evaluated
+// when the level is disabled. Use them when building the message is expensive.
+#define CARAMEL_TRACE if (!logger.isEnabled(TRACE)) {} else logger.trace()
+#define CARAMEL_DEBUG if (!logger.isEnabled(DEBUG)) {} else logger.debug()
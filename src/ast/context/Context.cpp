@@ -29,11 +29,11 @@ namespace caramel::ast {
 
 Context::Context()
         : mParent{},
-          mSymbolTable(std::make_shared<SymbolTable>()) {}
+          mSymbolTable(utils::makeNode<SymbolTable>()) {}
 
 Context::Context(std::shared_ptr<Context> const &parent)
         : mParent{parent},
-          mSymbolTable(std::make_shared<SymbolTable>(parent->getSymbolTable())) {}
+          mSymbolTable(utils::makeNode<SymbolTable>(parent->getSymbolTable())) {}
 
 std::shared_ptr<Context> Context::getParent() const {
     return mParent;
@@ -73,8 +73,8 @@ void Context::visitChildrenAstDot() {
 std::ostream &operator<<(std::ostream &os, Context const &context) {
     os << "Context: " << context.mStatements.size() << " statements, and "
        << context.mSymbolTable->getNumberOfSymbols() << " symbols:";
-    for (auto const&[name, symbol] : context.mSymbolTable->getSymbols()) {
-        os << "\n  - " << name << ", " << symbol->getSymbolType();
+    for (auto const&[id, symbol] : context.mSymbolTable->getSymbols()) {
+        os << "\n  - " << utils::internedString(id) << ", " << symbol->getSymbolType();
     }
     return os;
 }
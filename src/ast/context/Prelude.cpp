@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Prelude.h"
+#include "../../Logger.h"
+#include "../../utils/Common.h"
+#include "../symboltable/PrimaryType.h"
+#include "../statements/declaration/FunctionDeclaration.h"
+
+
+using namespace caramel::ast;
+using namespace caramel::utils;
+
+std::vector<Declaration::Ptr> caramel::ast::declarePrelude(Context::Ptr const &rootContext,
+                                                          antlr4::ParserRuleContext *programContext) {
+    SymbolTable::Ptr symbolTable = rootContext->getSymbolTable();
+
+    // Add types
+    logger.debug() << "Adding primary types.";
+    PrimaryType::Ptr void_t = Void_t::Create();
+    PrimaryType::Ptr char_t = Char::Create();
+    PrimaryType::Ptr int8_t = Int8_t::Create();
+    PrimaryType::Ptr int16_t = Int16_t::Create();
+    PrimaryType::Ptr int32_t = Int32_t::Create();
+    PrimaryType::Ptr int64_t = Int64_t::Create();
+
+    symbolTable->addPrimaryType(void_t, void_t->getIdentifier());
+    symbolTable->addPrimaryType(char_t, char_t->getIdentifier());
+    symbolTable->addPrimaryType(int8_t, int8_t->getIdentifier());
+    symbolTable->addPrimaryType(int16_t, int16_t->getIdentifier());
+    symbolTable->addPrimaryType(int32_t, int32_t->getIdentifier());
+    symbolTable->addPrimaryType(int64_t, int64_t->getIdentifier());
+
+    // Add prelude functions
+    // puts
+    logger.debug() << "Adding prelude functions.";
+    // TODO: Declare puts in prelude when constString_t will be handled
+//    auto putsDecl = makeNode<FunctionDeclaration>(programContext->getStart());
+//    std::vector<FunctionParameterSignature> putsParams = {
+//            {"c", char_t, SymbolType::VariableSymbol}
+//    };
+//    auto putsSymbol = symbolTable->addFunctionDeclaration(programContext, void_t, "puts", putsParams, putsDecl);
+//    putsDecl->setFunctionSymbol(putsSymbol);
+    // printf
+    auto printfDecl = makeNode<FunctionDeclaration>(programContext->getStart());
+    std::vector<FunctionParameterSignature> printfParams = {};
+    auto printfSymbol = symbolTable->addFunctionDeclaration(
+            programContext, void_t, "printf", printfParams, printfDecl, true);
+    printfDecl->setFunctionSymbol(printfSymbol);
+    // putchar
+    auto putcharDecl = makeNode<FunctionDeclaration>(programContext->getStart());
+    std::vector<FunctionParameterSignature> putcharParams = {
+            {"c", int32_t, SymbolType::VariableSymbol}
+    };
+    auto putcharSymbol = symbolTable->addFunctionDeclaration(
+            programContext, void_t, "putchar", putcharParams, putcharDecl);
+    putcharDecl->setFunctionSymbol(putcharSymbol);
+    // getchar
+    auto getcharDecl = makeNode<FunctionDeclaration>(programContext->getStart());
+    std::vector<FunctionParameterSignature> getcharParams = {};
+    auto getcharSymbol = symbolTable->addFunctionDeclaration(
+            programContext, int32_t, "getchar", getcharParams, getcharDecl);
+    getcharDecl->setFunctionSymbol(getcharSymbol);
+    // exit
+    auto exitDecl = makeNode<FunctionDeclaration>(programContext->getStart());
+    std::vector<FunctionParameterSignature> exitParams = {
+            {"code", int32_t, SymbolType::VariableSymbol}
+    };
+    auto exitSymbol = symbolTable->addFunctionDeclaration(
+            programContext, void_t, "exit", exitParams, exitDecl);
+    exitDecl->setFunctionSymbol(exitSymbol);
+
+    return {printfDecl, putcharDecl, getcharDecl, exitDecl};
+}
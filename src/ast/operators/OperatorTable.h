@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "../../Logger.h"
+
+#include <Vocabulary.h>
+
+#include <array>
+#include <cstdlib>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+
+namespace caramel::ast {
+
+/// The operators are stateless: each one has a single instance, created on first use and shared by all expressions.
+template<typename Op, typename OperatorType>
+typename OperatorType::Ptr const &operatorInstance() {
+    static typename OperatorType::Ptr const instance = std::make_shared<Op>();
+    return instance;
+}
+
+template<typename OperatorType>
+struct OperatorBinding {
+    size_t tokenType;
+    typename OperatorType::Ptr const &(*instance)();
+};
+
+template<typename OperatorType>
+struct LiteralOperatorBinding {
+    std::string_view literal; // Quoted as in the vocabulary, e.g. "'+'"
+    typename OperatorType::Ptr const &(*instance)();
+};
+
+/**
+ * Maps the token types of a front-end to the operator instances, in a table built at compile time.
+ * Binding a token type which does not fit in Size fails the constant evaluation of the table.
+ */
+template<typename OperatorType, size_t Size>
+class OperatorTable {
+public:
+    constexpr OperatorTable(std::initializer_list<OperatorBinding<OperatorType>> bindings)
+            : mInstances{} {
+        for (OperatorBinding<OperatorType> const &binding : bindings) {
+            mInstances[binding.tokenType] = binding.instance;
+        }
+    }
+
+    /// Returns nullptr if the token type is not bound to an operator.
+    typename OperatorType::Ptr getOpForToken(size_t tokenType) const {
+        if (tokenType >= Size || nullptr == mInstances[tokenType]) {
+            return nullptr;
+        }
+        return mInstances[tokenType]();
+    }
+
+private:
+    std::array<typename OperatorType::Ptr const &(*)(), Size> mInstances;
+};
+
+/**
+ * Maps the token types of a generated parser to the operator instances, from the literal names of its vocabulary.
+ * The generated token types depend on the grammar, so the table is sized and filled once the parser is built.
+ * Exits if the grammar has no token for one of the literals.
+ */
+template<typename OperatorType>
+class VocabularyOperatorTable {
+public:
+    VocabularyOperatorTable(
+            antlr4::dfa::Vocabulary const &vocabulary,
+            std::initializer_list<LiteralOperatorBinding<OperatorType>> bindings
+    ) : mInstances(vocabulary.getMaxTokenType() + 1, nullptr) {
+        for (LiteralOperatorBinding<OperatorType> const &binding : bindings) {
+            bool bound = false;
+            for (size_t tokenType = 0; tokenType < mInstances.size(); ++tokenType) {
+                if (vocabulary.getLiteralName(tokenType) == binding.literal) {
+                    mInstances[tokenType] = binding.instance;
+                    bound = true;
+                }
+            }
+            if (!bound) {
+                logger.fatal() << "The grammar has no token for the operator " << binding.literal << ".";
+                exit(1);
+            }
+        }
+    }
+
+    /// Returns nullptr if the token type is not bound to an operator.
+    typename OperatorType::Ptr getOpForToken(size_t tokenType) const {
+        if (tokenType >= mInstances.size() || nullptr == mInstances[tokenType]) {
+            return nullptr;
+        }
+        return mInstances[tokenType]();
+    }
+
+private:
+    std::vector<typename OperatorType::Ptr const &(*)()> mInstances;
+};
+
+} // namespace caramel::ast
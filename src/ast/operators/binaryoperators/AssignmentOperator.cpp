@@ -57,7 +57,7 @@ std::shared_ptr<ir::IR> AssignmentOperator::getIR(
         std::string rvalue = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
         std::string index = SAFE_ADD_INSTRUCTION(indexExpr, currentBasicBlock);
 
-        return castTo<ir::IR::Ptr>(std::make_shared<ir::ArrayAccessInstruction>(
+        return castTo<ir::IR::Ptr>(utils::makeNode<ir::ArrayAccessInstruction>(
                 currentBasicBlock,
                 maxType,
                 Statement::createVarName(),
@@ -70,10 +70,10 @@ std::shared_ptr<ir::IR> AssignmentOperator::getIR(
         std::string lvalue = SAFE_ADD_INSTRUCTION(lvalueExpr, currentBasicBlock);
 
         std::string rvalue;
-        if (castTo<LValue::Ptr>(rightExpression)) {
+        if (rightExpression->getType() == StatementType::Identifier) {
             LValue::Ptr rightExpressionAsLValue = castTo<LValue::Ptr>(rightExpression);
             rvalue = currentBasicBlock->addInstruction(
-                    std::make_shared<ir::AdditionInstruction>(
+                    utils::makeNode<ir::AdditionInstruction>(
                             Statement::createVarName(),
                             currentBasicBlock,
                             maxType,
@@ -85,7 +85,7 @@ std::shared_ptr<ir::IR> AssignmentOperator::getIR(
             rvalue = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
         }
 
-        return castTo<ir::IR::Ptr>(std::make_shared<ir::CopyInstruction>(
+        return castTo<ir::IR::Ptr>(utils::makeNode<ir::CopyInstruction>(
                 currentBasicBlock,
                 maxType,
                 lvalue,
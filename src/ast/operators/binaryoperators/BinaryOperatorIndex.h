@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (c) 2018 Kalate Hexanome, 4IF, INSA Lyon
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -25,22 +25,77 @@
 #pragma once
 
 #include "../BinaryOperator.h"
+#include "../OperatorTable.h"
+#include "../../../Logger.h"
+#include "PlusOperator.h"
+#include "MinusOperator.h"
+#include "MultOperator.h"
+#include "DivOperator.h"
+#include "ModOperator.h"
+#include "RightShiftOperator.h"
+#include "LeftShiftOperator.h"
+#include "LowerThanOperator.h"
+#include "LowerEqThanOperator.h"
+#include "GreaterThanOperator.h"
+#include "GreaterEqThanOperator.h"
+#include "EqualityOperator.h"
+#include "NotEqOperator.h"
+#include "BitwiseAndOperator.h"
+#include "BitwiseXorOperator.h"
+#include "BitwiseOrOperator.h"
+#include "ConjunctionOperator.h"
+#include "DisjunctionOperator.h"
+#include "AssignmentOperator.h"
+#include "PlusAssignmentOperator.h"
+#include "MinusAssignmentOperator.h"
+#include "TimesAssignmentOperator.h"
+#include "DivAssignmentOperator.h"
+#include "ModAssignmentOperator.h"
+#include "BitwiseAndAssignmentOperator.h"
+#include "BitwiseOrAssignmentOperator.h"
+#include "BitwiseXorAssignmentOperator.h"
+#include "LeftShiftAssignmentOperator.h"
+#include "RightShiftAssignmentOperator.h"
 
-namespace caramel::ast {
+#include <cstdlib>
 
-class BinaryOperatorIndex {
 
-public:
-    BinaryOperatorIndex();
+namespace caramel::ast {
 
-    BinaryOperator::Ptr getOpForToken(std::string token);
+template<typename Op>
+constexpr OperatorBinding<BinaryOperator> bindBinaryOperator(size_t tokenType) {
+    return {tokenType, &operatorInstance<Op, BinaryOperator>};
+}
 
-private:
-    typedef std::map<std::string, BinaryOperator::Ptr> IndexMap;
+template<typename Op>
+constexpr LiteralOperatorBinding<BinaryOperator> bindBinaryOperator(std::string_view literal) {
+    return {literal, &operatorInstance<Op, BinaryOperator>};
+}
 
-    IndexMap index;
+/**
+ * The binary operators of a front-end, indexed by token type.
+ * The hand-written parser declares its index as a constexpr table of its own token types,
+ * the ANTLR visitor builds it from the literals of the generated parser's vocabulary.
+ */
+template<typename Table>
+class BinaryOperatorLookup : public Table {
+public:
+    using Table::Table;
 
+    /// Exits if the token type is not bound to a binary operator.
+    BinaryOperator::Ptr getOpForToken(size_t tokenType) const {
+        BinaryOperator::Ptr binaryOperator = Table::getOpForToken(tokenType);
+        if (nullptr == binaryOperator) {
+            logger.fatal() << "Operator of token type " << tokenType << " not found.";
+            exit(1);
+        }
+        return binaryOperator;
+    }
 };
 
-}
+template<size_t Size>
+using BinaryOperatorIndex = BinaryOperatorLookup<OperatorTable<BinaryOperator, Size>>;
+
+using BinaryOperatorVocabulary = BinaryOperatorLookup<VocabularyOperatorTable<BinaryOperator>>;
 
+} // namespace caramel::ast
@@ -47,7 +47,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::BitwiseOrOperator::getIR(
     std::string left = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
     std::string right = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::BitwiseOrInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::BitwiseOrInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             maxType,
@@ -34,21 +34,19 @@ using namespace caramel::ast;
 using namespace caramel::utils;
 using namespace caramel;
 
-int ConjunctionOperator::nb = 0;
 
 ir::GetBasicBlockReturn ConjunctionOperator::getBasicBlock(ir::CFG *controlFlow,
                                                            std::shared_ptr<Expression> const &leftExpression,
                                                            std::shared_ptr<Expression> const &rightExpression) {
-    nb++;
-    int currentNb = nb;
-    ir::BasicBlock::Ptr startBlock = controlFlow->generateBasicBlock(
-            ir::BasicBlock::getNextNumberName() + "_" + std::to_string(currentNb) + "_and_start");
-    ir::BasicBlock::Ptr trueBlock  = controlFlow->generateBasicBlock(
-            ir::BasicBlock::getNextNumberName() + "_" + std::to_string(currentNb) + "_and_true");
-    ir::BasicBlock::Ptr falseBlock  = controlFlow->generateBasicBlock(
-            ir::BasicBlock::getNextNumberName() + "_" + std::to_string(currentNb) + "_and_false");
-    ir::BasicBlock::Ptr endBlock = controlFlow->generateBasicBlock(
-            ir::BasicBlock::getNextNumberName() + "_" + std::to_string(currentNb) + "_and_end");
+    int currentNb = ir::FunctionFrame::lowered().getNaming().newLogicalOperator();
+    ir::BasicBlock::Ptr startBlock = controlFlow->generateLabeledBasicBlock(
+            "_" + std::to_string(currentNb) + "_and_start");
+    ir::BasicBlock::Ptr trueBlock  = controlFlow->generateLabeledBasicBlock(
+            "_" + std::to_string(currentNb) + "_and_true");
+    ir::BasicBlock::Ptr falseBlock  = controlFlow->generateLabeledBasicBlock(
+            "_" + std::to_string(currentNb) + "_and_false");
+    ir::BasicBlock::Ptr endBlock = controlFlow->generateLabeledBasicBlock(
+            "_" + std::to_string(currentNb) + "_and_end");
 
     ir::BasicBlock::Ptr constEnd = endBlock;
 
@@ -59,7 +57,7 @@ ir::GetBasicBlockReturn ConjunctionOperator::getBasicBlock(ir::CFG *controlFlow,
     PrimaryType::Ptr Int64Type = std::make_shared<Int64_t>();
 
     trueBlock->setExitWhenTrue(endBlock);
-    trueBlock->addInstruction(std::make_shared<ir::LDConstInstruction>(
+    trueBlock->addInstruction(utils::makeNode<ir::LDConstInstruction>(
             trueBlock,
             Int64Type,
             returnName,
@@ -67,14 +65,14 @@ ir::GetBasicBlockReturn ConjunctionOperator::getBasicBlock(ir::CFG *controlFlow,
     ));
 
     falseBlock->setExitWhenTrue(endBlock);
-    falseBlock->addInstruction(std::make_shared<ir::LDConstInstruction>(
+    falseBlock->addInstruction(utils::makeNode<ir::LDConstInstruction>(
             falseBlock,
             Int64Type,
             returnName,
             "0"
     ));
 
-    endBlock->addInstruction(std::make_shared<ir::EmptyInstruction>(
+    endBlock->addInstruction(utils::makeNode<ir::EmptyInstruction>(
             returnName,
             endBlock,
             Int64Type
@@ -95,8 +93,8 @@ ir::GetBasicBlockReturn ConjunctionOperator::getBasicBlock(ir::CFG *controlFlow,
     }
 
     if (rightExpression->shouldReturnAnIR()) {
-        ir::BasicBlock::Ptr midBlock = controlFlow->generateBasicBlock(
-                ir::BasicBlock::getNextNumberName() + "_" + std::to_string(currentNb) + "_and_mid");
+        ir::BasicBlock::Ptr midBlock = controlFlow->generateLabeledBasicBlock(
+                "_" + std::to_string(currentNb) + "_and_mid");
         SAFE_ADD_INSTRUCTION(rightExpression, midBlock);
 
         midBlock->setExitWhenTrue(trueBlock);
@@ -135,7 +133,7 @@ std::shared_ptr<ir::IR> ConjunctionOperator::getIR(std::shared_ptr<ir::BasicBloc
     currentBasicBlock->setExitWhenFalse(nullptr);
     currentBasicBlock = end;
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::EmptyInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::EmptyInstruction>(
             currentBasicBlock->getInstructions().back()->getReturnName(),
             currentBasicBlock,
             currentBasicBlock->getInstructions().back()->getType()
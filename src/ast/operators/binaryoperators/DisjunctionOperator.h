@@ -58,8 +58,6 @@ public:
     std::shared_ptr<ir::IR> getIR(std::shared_ptr<ir::BasicBlock> &currentBasicBlock,
                                   std::shared_ptr<caramel::ast::Expression> const &leftExpression,
                                   std::shared_ptr<caramel::ast::Expression> const &rightExpression) override;
-private:
-    static int nb;
 };
 
 } // namespace caramel::ast
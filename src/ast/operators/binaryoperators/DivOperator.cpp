@@ -44,7 +44,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::DivOperator::getIR(
     std::string left = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
     std::string right = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::DivInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::DivInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             maxType,
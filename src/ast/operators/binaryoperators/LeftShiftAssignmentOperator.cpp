@@ -26,7 +26,6 @@
 #include "../../../utils/Common.h"
 #include "../../../ir/BasicBlock.h"
 #include "../../../ir/helpers/IROperatorHelper.h"
-#include "../../../ir/instructions/CopyInstruction.h"
 #include "../../../ir/instructions/LeftShiftInstruction.h"
 #include "../../statements/expressions/atomicexpression/LValue.h"
 
@@ -42,7 +41,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::LeftShiftAssignmentOperator::getI
 
     std::string tmpName = Statement::createVarName();
     std::string lvalueRegister = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
-    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(std::make_shared<ir::LeftShiftInstruction>(
+    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(utils::makeNode<ir::LeftShiftInstruction>(
             tmpName,
             currentBasicBlock,
             leftExpression->getPrimaryType(),
@@ -51,12 +50,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::LeftShiftAssignmentOperator::getI
     )));
 
     auto lvalue = castTo<LValue::Ptr>(leftExpression);
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::CopyInstruction>(
-            currentBasicBlock,
-            leftExpression->getPrimaryType(),
-            lvalue->getSymbol()->getName(),
-            tmpName
-    ));
+    return lvalue->getAssignmentIR(currentBasicBlock, leftExpression->getPrimaryType(), tmpName);
 }
 
 caramel::ast::StatementType caramel::ast::LeftShiftAssignmentOperator::getExpressionType() const {
@@ -41,7 +41,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::LowerEqThanOperator::getIR(
     std::string left = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
     std::string right = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
 
-    std::shared_ptr<ir::FlagToRegInstruction> instr = std::make_shared<ir::FlagToRegInstruction>(
+    std::shared_ptr<ir::FlagToRegInstruction> instr = utils::makeNode<ir::FlagToRegInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             maxType,
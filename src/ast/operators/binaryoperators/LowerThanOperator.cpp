@@ -41,7 +41,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::LowerThanOperator::getIR(
     std::string left = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
     std::string right = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::FlagToRegInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::FlagToRegInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             maxType,
@@ -42,7 +42,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::MinusOperator::getIR(
     std::string left = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
     std::string right = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::SubtractionInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::SubtractionInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             maxType,
@@ -43,7 +43,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::ModOperator::getIR(
     std::string left = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
     std::string right = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::ModInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::ModInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             maxType,
@@ -42,7 +42,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PlusOperator::getIR(
     std::string left = SAFE_ADD_INSTRUCTION(leftExpression, currentBasicBlock);
     std::string right = SAFE_ADD_INSTRUCTION(rightExpression, currentBasicBlock);
 
-    std::shared_ptr<ir::AdditionInstruction> instr = std::make_shared<ir::AdditionInstruction>(
+    std::shared_ptr<ir::AdditionInstruction> instr = utils::makeNode<ir::AdditionInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             maxType,
@@ -40,7 +40,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PostDecrOperator::buildIR(
 ) {
     auto lvalue = castTo<LValue::Ptr>(expression);
     std::string oldValue = Statement::createVarName();
-    currentBasicBlock->addInstruction(std::make_shared<ir::CopyInstruction>(
+    currentBasicBlock->addInstruction(utils::makeNode<ir::CopyInstruction>(
             currentBasicBlock,
             expression->getPrimaryType(),
             oldValue,
@@ -49,7 +49,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PostDecrOperator::buildIR(
 
     std::string tmpName = Statement::createVarName();
     std::string lvalueRegister = SAFE_ADD_INSTRUCTION(expression, currentBasicBlock);
-    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(std::make_shared<ir::SubtractionInstruction>(
+    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(utils::makeNode<ir::SubtractionInstruction>(
             tmpName,
             currentBasicBlock,
             expression->getPrimaryType(),
@@ -57,14 +57,14 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PostDecrOperator::buildIR(
             "1"
     )));
 
-    currentBasicBlock->addInstruction(std::make_shared<ir::CopyInstruction>(
+    currentBasicBlock->addInstruction(utils::makeNode<ir::CopyInstruction>(
             currentBasicBlock,
             expression->getPrimaryType(),
             lvalue->getSymbol()->getName(),
             tmpName
     ));
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::EmptyInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::EmptyInstruction>(
             oldValue,
             currentBasicBlock,
             expression->getPrimaryType()
@@ -39,7 +39,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PostIncOperator::buildIR(
 ) {
     auto lvalue = castTo<LValue::Ptr>(expression);
     std::string oldValue = Statement::createVarName();
-    currentBasicBlock->addInstruction(std::make_shared<ir::CopyInstruction>(
+    currentBasicBlock->addInstruction(utils::makeNode<ir::CopyInstruction>(
             currentBasicBlock,
             expression->getPrimaryType(),
             oldValue,
@@ -48,7 +48,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PostIncOperator::buildIR(
 
     std::string tmpName = Statement::createVarName();
     std::string lvalueRegister = SAFE_ADD_INSTRUCTION(expression, currentBasicBlock);
-    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(std::make_shared<ir::AdditionInstruction>(
+    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(utils::makeNode<ir::AdditionInstruction>(
             tmpName,
             currentBasicBlock,
             expression->getPrimaryType(),
@@ -56,14 +56,14 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PostIncOperator::buildIR(
             "1"
     )));
 
-    currentBasicBlock->addInstruction(std::make_shared<ir::CopyInstruction>(
+    currentBasicBlock->addInstruction(utils::makeNode<ir::CopyInstruction>(
             currentBasicBlock,
             expression->getPrimaryType(),
             lvalue->getSymbol()->getName(),
             tmpName
     ));
 
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::EmptyInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::EmptyInstruction>(
             oldValue,
             currentBasicBlock,
             expression->getPrimaryType()
@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (c) 2018 Kalate Hexanome, 4IF, INSA Lyon
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -25,22 +25,27 @@
 #pragma once
 
 #include "../UnaryOperator.h"
+#include "../OperatorTable.h"
+#include "PostIncOperator.h"
+#include "PostDecrOperator.h"
 
-namespace caramel::ast {
-
-class PostfixOperatorIndex {
 
-public:
-    PostfixOperatorIndex();
-
-    UnaryOperator::Ptr getOpForToken(std::string token);
+namespace caramel::ast {
 
-private:
-    typedef std::map<std::string, UnaryOperator::Ptr> IndexMap;
+template<typename Op>
+constexpr OperatorBinding<UnaryOperator> bindPostfixOperator(size_t tokenType) {
+    return {tokenType, &operatorInstance<Op, UnaryOperator>};
+}
 
-    IndexMap index;
+template<typename Op>
+constexpr LiteralOperatorBinding<UnaryOperator> bindPostfixOperator(std::string_view literal) {
+    return {literal, &operatorInstance<Op, UnaryOperator>};
+}
 
-};
+/// The postfix operators of a front-end, indexed by token type. The lookup gives nullptr for the other tokens.
+template<size_t Size>
+using PostfixOperatorIndex = OperatorTable<UnaryOperator, Size>;
 
-}
+using PostfixOperatorVocabulary = VocabularyOperatorTable<UnaryOperator>;
 
+} // namespace caramel::ast
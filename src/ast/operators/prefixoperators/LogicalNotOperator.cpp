@@ -39,7 +39,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::LogicalNotOperator::buildIR(
         std::shared_ptr<ir::BasicBlock> &currentBasicBlock,
         std::shared_ptr<caramel::ast::Expression> const &expression
 ) {
-    return std::make_shared<BinaryExpression>(
+    return utils::makeNode<BinaryExpression>(
             castTo<Expression::Ptr>(expression),
             castTo<BinaryOperator::Ptr>(std::make_shared<EqualityOperator>()),
             castTo<Expression::Ptr>(Constant::defaultConstant(nullptr)),
@@ -40,7 +40,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PreDecrOperator::buildIR(
 ) {
     std::string tmpName = Statement::createVarName();
     std::string lvalueRegister = SAFE_ADD_INSTRUCTION(expression, currentBasicBlock);
-    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(std::make_shared<ir::SubtractionInstruction>(
+    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(utils::makeNode<ir::SubtractionInstruction>(
             tmpName,
             currentBasicBlock,
             expression->getPrimaryType(),
@@ -49,7 +49,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PreDecrOperator::buildIR(
     )));
 
     auto lvalue = castTo<LValue::Ptr>(expression);
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::CopyInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::CopyInstruction>(
             currentBasicBlock,
             expression->getPrimaryType(),
             lvalue->getSymbol()->getName(),
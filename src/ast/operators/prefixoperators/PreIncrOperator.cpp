@@ -38,7 +38,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PreIncrOperator::buildIR(
 ) {
     std::string tmpName = Statement::createVarName();
     std::string lvalueRegister = SAFE_ADD_INSTRUCTION(expression, currentBasicBlock);
-    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(std::make_shared<ir::AdditionInstruction>(
+    currentBasicBlock->addInstruction(castTo<ir::IR::Ptr>(utils::makeNode<ir::AdditionInstruction>(
             tmpName,
             currentBasicBlock,
             expression->getPrimaryType(),
@@ -47,7 +47,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PreIncrOperator::buildIR(
     )));
 
     auto lvalue = castTo<LValue::Ptr>(expression);
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::CopyInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::CopyInstruction>(
             currentBasicBlock,
             expression->getPrimaryType(),
             lvalue->getSymbol()->getName(),
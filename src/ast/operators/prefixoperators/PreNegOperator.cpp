@@ -38,7 +38,7 @@ std::shared_ptr<caramel::ir::IR> caramel::ast::PreNegOperator::buildIR(
         std::shared_ptr<caramel::ast::Expression> const &expression
 ) {
     std::string before = SAFE_ADD_INSTRUCTION(expression, currentBasicBlock);
-    return castTo<ir::IR::Ptr>(std::make_shared<ir::SubtractionInstruction>(
+    return castTo<ir::IR::Ptr>(utils::makeNode<ir::SubtractionInstruction>(
             Statement::createVarName(),
             currentBasicBlock,
             expression->getPrimaryType(),
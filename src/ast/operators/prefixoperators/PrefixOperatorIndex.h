@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (c) 2018 Kalate Hexanome, 4IF, INSA Lyon
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -25,22 +25,29 @@
 #pragma once
 
 #include "../UnaryOperator.h"
+#include "../OperatorTable.h"
+#include "PreIncrOperator.h"
+#include "PreDecrOperator.h"
+#include "LogicalNotOperator.h"
+#include "PreNegOperator.h"
 
-namespace caramel::ast {
-
-class PrefixOperatorIndex {
 
-public:
-    PrefixOperatorIndex();
-
-    UnaryOperator::Ptr getOpForToken(std::string token);
+namespace caramel::ast {
 
-private:
-    typedef std::map<std::string, UnaryOperator::Ptr> IndexMap;
+template<typename Op>
+constexpr OperatorBinding<UnaryOperator> bindPrefixOperator(size_t tokenType) {
+    return {tokenType, &operatorInstance<Op, UnaryOperator>};
+}
 
-    IndexMap index;
+template<typename Op>
+constexpr LiteralOperatorBinding<UnaryOperator> bindPrefixOperator(std::string_view literal) {
+    return {literal, &operatorInstance<Op, UnaryOperator>};
+}
 
-};
+/// The prefix operators of a front-end, indexed by token type. The lookup gives nullptr for the other tokens.
+template<size_t Size>
+using PrefixOperatorIndex = OperatorTable<UnaryOperator, Size>;
 
-}
+using PrefixOperatorVocabulary = VocabularyOperatorTable<UnaryOperator>;
 
+} // namespace caramel::ast
@@ -24,11 +24,14 @@
 
 #include "Statement.h"
 #include "../../ir/IR.h"
+#include "../../ir/FunctionFrame.h"
 
 
 namespace caramel::ast {
 
-long long Statement::lastTemVarNumber = -1;
+std::string Statement::createVarName() {
+    return ir::FunctionFrame::lowered().getNaming().newTemporaryName();
+}
 
 Statement::Statement(antlr4::Token *startToken, StatementType type)
         : mType{type} {
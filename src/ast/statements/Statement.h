@@ -29,6 +29,7 @@
 #include "../../AstDotNode.h"
 #include "../symboltable/PrimaryType.h"
 #include "../../exceptions/NotImplementedException.h"
+#include "../../utils/Arena.h"
 
 #include <Token.h>
 
@@ -59,9 +60,10 @@ public:
     using Ptr = std::shared_ptr<Statement>;
     using WeakPtr = std::weak_ptr<Statement>;
 
-    static std::string createVarName() {
-        return "!tmp" + std::to_string(++lastTemVarNumber);
-    }
+    /**
+     * A new temporary of the function being lowered.
+     */
+    static std::string createVarName();
 
 public:
     ~Statement() override = default;
@@ -105,9 +107,6 @@ public:
         return nullptr != dynamic_cast<T*>(this);
     }
 
-protected:
-    static long long lastTemVarNumber;
-
 private:
     size_t mLine;
     size_t mColumn;
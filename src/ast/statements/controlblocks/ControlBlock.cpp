@@ -23,6 +23,8 @@
 */
 
 #include "ControlBlock.h"
+#include "../expressions/atomicexpression/Identifier.h"
+#include "../../../utils/Common.h"
 
 
 namespace caramel::ast {
@@ -30,4 +32,19 @@ namespace caramel::ast {
 ControlBlock::ControlBlock(antlr4::Token *startToken, StatementType type)
         : Statement(startToken, type) {}
 
+std::string ControlBlock::getVariableName(Expression::Ptr const &expression) {
+    auto identifier = utils::castTo<Identifier::Ptr>(expression);
+    if (!identifier || !identifier->getSymbol() || identifier->isAddress()) {
+        return "";
+    }
+    return identifier->getSymbol()->getName();
+}
+
+std::optional<long long> ControlBlock::getConstantValue(Expression::Ptr const &expression) {
+    if (!expression) {
+        return {};
+    }
+    return expression->getConstantValue();
+}
+
 } // namespace caramel::ast
@@ -25,9 +25,12 @@
 #pragma once
 
 #include "../Statement.h"
+#include "../expressions/Expression.h"
 
 #include "../../../exceptions/NotImplementedException.h"
 
+#include <optional>
+
 
 namespace caramel::ast {
 
@@ -40,6 +43,11 @@ protected:
     explicit ControlBlock(antlr4::Token *startToken, StatementType type = StatementType::ControlBlock);
 
     ~ControlBlock() override = default;
+
+    // Returns the name of the scalar variable if expression is a plain identifier, "" otherwise
+    static std::string getVariableName(Expression::Ptr const &expression);
+
+    static std::optional<long long> getConstantValue(Expression::Ptr const &expression);
 };
 
 } // caramel::ast::ast
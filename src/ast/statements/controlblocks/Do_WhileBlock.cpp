@@ -59,9 +59,9 @@ void Do_WhileBlock::visitChildrenAstDot() {
 ir::GetBasicBlockReturn Do_WhileBlock::getBasicBlock(
         ir::CFG *controlFlow
 ) {
-    ir::BasicBlock::Ptr bbDWcond = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_DWcond");
-    ir::BasicBlock::Ptr bbDWaction = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_DWaction");
-    ir::BasicBlock::Ptr bbDWend = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_DWend");
+    ir::BasicBlock::Ptr bbDWcond = controlFlow->generateLabeledBasicBlock("_DWcond");
+    ir::BasicBlock::Ptr bbDWaction = controlFlow->generateLabeledBasicBlock("_DWaction");
+    ir::BasicBlock::Ptr bbDWend = controlFlow->generateLabeledBasicBlock("_DWend");
 
     controlFlow->pushCurrentControlBlockEndBB(bbDWend);
 
@@ -23,12 +23,78 @@
 */
 
 #include "ForBlock.h"
+#include "../expressions/atomicexpression/ArrayAccess.h"
+#include "../expressions/binaryexpression/BinaryExpression.h"
+#include "../expressions/unaryexpression/UnaryExpression.h"
+#include "../../operators/binaryoperators/AssignmentOperator.h"
+#include "../../operators/binaryoperators/PlusOperator.h"
+#include "../../operators/binaryoperators/PlusAssignmentOperator.h"
+#include "../../operators/binaryoperators/MinusOperator.h"
+#include "../../operators/binaryoperators/MinusAssignmentOperator.h"
+#include "../../operators/binaryoperators/BitwiseAndOperator.h"
+#include "../../operators/binaryoperators/BitwiseAndAssignmentOperator.h"
+#include "../../operators/binaryoperators/BitwiseOrOperator.h"
+#include "../../operators/binaryoperators/BitwiseOrAssignmentOperator.h"
+#include "../../operators/binaryoperators/BitwiseXorOperator.h"
+#include "../../operators/binaryoperators/BitwiseXorAssignmentOperator.h"
+#include "../../operators/binaryoperators/LowerThanOperator.h"
+#include "../../operators/binaryoperators/LowerEqThanOperator.h"
+#include "../../operators/postfixoperators/PostIncOperator.h"
+#include "../../operators/prefixoperators/PreIncrOperator.h"
 #include "../../../ir/BasicBlock.h"
 #include "../../../ir/helpers/IROperatorHelper.h"
+#include "../../../ir/instructions/VectorLoopInstruction.h"
+#include "../../../ir/instructions/FlagToRegInstruction.h"
+#include "../../../utils/Common.h"
+
+#include <limits>
+#include <algorithm>
 
 
 namespace caramel::ast {
 
+using namespace caramel::utils;
+
+static constexpr size_t MAX_UNROLL_FACTOR = 8;
+static constexpr size_t MAX_UNROLLED_BODY_SIZE = 64; // In IR instructions
+
+static std::optional<ir::VectorOperation> getVectorOperation(std::string const &token) {
+    if (token == PlusOperator::SYMBOL || token == PlusAssignmentOperator::SYMBOL) {
+        return ir::VectorOperation::Add;
+    } else if (token == MinusOperator::SYMBOL || token == MinusAssignmentOperator::SYMBOL) {
+        return ir::VectorOperation::Sub;
+    } else if (token == BitwiseAndOperator::SYMBOL || token == BitwiseAndAssignmentOperator::SYMBOL) {
+        return ir::VectorOperation::And;
+    } else if (token == BitwiseOrOperator::SYMBOL || token == BitwiseOrAssignmentOperator::SYMBOL) {
+        return ir::VectorOperation::Or;
+    } else if (token == BitwiseXorOperator::SYMBOL || token == BitwiseXorAssignmentOperator::SYMBOL) {
+        return ir::VectorOperation::Xor;
+    }
+    return {};
+}
+
+static bool fitsInt32(long long value) {
+    return value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max();
+}
+
+// Every block from begin up to stop, when && or || split the lowered code in several blocks
+static std::vector<ir::BasicBlock::Ptr> getBlocksUntil(ir::BasicBlock::Ptr const &begin,
+                                                       ir::BasicBlock::Ptr const &stop) {
+    std::vector<ir::BasicBlock::Ptr> blocks;
+    std::vector<ir::BasicBlock::Ptr> toVisit{begin};
+    while (!toVisit.empty()) {
+        ir::BasicBlock::Ptr bb = toVisit.back();
+        toVisit.pop_back();
+        if (!bb || bb == stop || std::find(blocks.begin(), blocks.end(), bb) != blocks.end()) {
+            continue;
+        }
+        blocks.push_back(bb);
+        toVisit.push_back(bb->getNextWhenTrue());
+        toVisit.push_back(bb->getNextWhenFalse());
+    }
+    return blocks;
+}
+
 ForBlock::ForBlock(
         std::shared_ptr<caramel::ast::Expression> begin,
         std::shared_ptr<caramel::ast::Expression> end,
@@ -73,11 +139,16 @@ bool ForBlock::shouldReturnABasicBlock() const {
 
 ir::GetBasicBlockReturn ForBlock::getBasicBlock(ir::CFG *controlFlow) {
 
-    ir::BasicBlock::Ptr bbInit = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Finit");
-    ir::BasicBlock::Ptr bbCond = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Fcond");
-    ir::BasicBlock::Ptr bbThen = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Fthen");
-    ir::BasicBlock::Ptr bbInc = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Finc");
-    ir::BasicBlock::Ptr bbEnd = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Fend");
+    ir::BasicBlock::Ptr bbInit = controlFlow->generateLabeledBasicBlock("_Finit");
+    ir::BasicBlock::Ptr bbCond = controlFlow->generateLabeledBasicBlock("_Fcond");
+    ir::BasicBlock::Ptr bbThen = controlFlow->generateLabeledBasicBlock("_Fthen");
+    ir::BasicBlock::Ptr bbInc = controlFlow->generateLabeledBasicBlock("_Finc");
+    ir::BasicBlock::Ptr bbEnd = controlFlow->generateLabeledBasicBlock("_Fend");
+
+    // The lowering moves bbInit and bbThen to the last block it creates
+    ir::BasicBlock::Ptr const bbBegin = bbInit;
+    ir::BasicBlock::Ptr const bbThenBegin = bbThen;
+    ir::BasicBlock::Ptr const bbIncBegin = bbInc;
 
     controlFlow->pushCurrentControlBlockEndBB(bbEnd);
 
@@ -87,9 +158,21 @@ ir::GetBasicBlockReturn ForBlock::getBasicBlock(ir::CFG *controlFlow) {
     bbThen->setExitWhenTrue(bbInc);
     bbInc->setExitWhenTrue(bbCond);
 
+    Config const &config = controlFlow->getConfig();
+    std::optional<CountedLoop> countedLoop;
+
     // INIT BB
     if (mBegin->shouldReturnAnIR()) {
         SAFE_ADD_INSTRUCTION(mBegin, bbInit); // bbInit->addInstruction(mBegin->getIR(bbInit));
+
+        if (config.optimize || config.unrollFactor > 1) {
+            countedLoop = getCountedLoop();
+        }
+
+        // The vectorized loop runs the bulk of the iterations, the scalar loop below the remainder
+        if (countedLoop && config.optimize) {
+            addVectorizedLoop(bbInit, *countedLoop);
+        }
     } else if (mBegin->shouldReturnABasicBlock()) {
         auto [init_begin, init_end] = mBegin->getBasicBlock(controlFlow);
 
@@ -150,9 +233,262 @@ ir::GetBasicBlockReturn ForBlock::getBasicBlock(ir::CFG *controlFlow) {
         bbInc = inc_end->getNewWhenTrueBasicBlock("_Fincafter");
     }
 
+    // UNROLLED LOOP, the scalar loop being kept for the remainder
+    if (countedLoop) {
+        addUnrolledLoop(controlFlow, *countedLoop, bbInit, bbCond, bbThenBegin, bbIncBegin, bbEnd);
+    }
+
     controlFlow->popCurrentControlBlockEndBB();
 
-    return {bbInit, bbEnd};
+    return {bbBegin, bbEnd};
+}
+
+std::optional<ForBlock::CountedLoop> ForBlock::getCountedLoop() const {
+    // counter = begin
+    auto begin = castTo<BinaryExpression::Ptr>(mBegin);
+    if (!begin || begin->getBinaryOperator()->getToken() != AssignmentOperator::SYMBOL) {
+        return {};
+    }
+    std::string const counter = getVariableName(begin->getLeftExpression());
+    auto const beginValue = getConstantValue(begin->getRightExpression());
+    if (counter.empty() || !beginValue) {
+        return {};
+    }
+
+    // counter < end, or counter <= end
+    auto end = castTo<BinaryExpression::Ptr>(mEnd);
+    if (!end || getVariableName(end->getLeftExpression()) != counter) {
+        return {};
+    }
+    auto endValue = getConstantValue(end->getRightExpression());
+    if (!endValue) {
+        return {};
+    }
+    std::string const endToken = end->getBinaryOperator()->getToken();
+    if (endToken == LowerEqThanOperator::SYMBOL) {
+        *endValue += 1;
+    } else if (endToken != LowerThanOperator::SYMBOL) {
+        return {};
+    }
+
+    // counter++, ++counter, or counter += 1
+    bool unitStep = false;
+    if (auto step = castTo<UnaryExpression::Ptr>(mStep)) {
+        std::string const stepToken = step->getUnaryOperator()->getToken();
+        unitStep = (stepToken == PostIncOperator::SYMBOL || stepToken == PreIncrOperator::SYMBOL)
+                   && getVariableName(step->getInnerExpression()) == counter;
+    } else if (auto step = castTo<BinaryExpression::Ptr>(mStep)) {
+        unitStep = step->getBinaryOperator()->getToken() == PlusAssignmentOperator::SYMBOL
+                   && getVariableName(step->getLeftExpression()) == counter
+                   && getConstantValue(step->getRightExpression()) == 1;
+    }
+    if (!unitStep) {
+        return {};
+    }
+
+    return CountedLoop{counter, begin->getLeftExpression()->getPrimaryType(), *beginValue, *endValue};
+}
+
+std::string ForBlock::getUnitStrideArray(
+        ir::BasicBlock::Ptr const &bb,
+        Expression::Ptr const &expression,
+        std::string const &counter
+) {
+    auto arrayAccess = castTo<ArrayAccess::Ptr>(expression);
+    if (!arrayAccess || !arrayAccess->getSymbol() || getVariableName(arrayAccess->getIndex()) != counter) {
+        return "";
+    }
+    std::string const arrayName = arrayAccess->getArrayName();
+    if (arrayAccess->getPrimaryType()->getMemoryLength() != 32
+        || !bb->hasSymbol(arrayName) || bb->isSymbolParamArray(arrayName) || bb->isSymbolGlobal(arrayName)) {
+        return "";
+    }
+    return arrayName;
+}
+
+bool ForBlock::addVectorizedLoop(ir::BasicBlock::Ptr const &bbInit, CountedLoop &loop) {
+    if (mBlock.size() != 1) {
+        return false;
+    }
+    auto statement = castTo<BinaryExpression::Ptr>(mBlock.front());
+    if (!statement) {
+        return false;
+    }
+
+    std::string const token = statement->getBinaryOperator()->getToken();
+    bool const isAssignment = token == AssignmentOperator::SYMBOL;
+    auto const lvalue = statement->getLeftExpression();
+    auto const rvalue = statement->getRightExpression();
+
+    std::optional<ir::VectorOperation> operation;
+    bool isReduction = false;
+    std::string destination = getUnitStrideArray(bbInit, lvalue, loop.counter);
+    std::string left;
+    Expression::Ptr right;
+
+    if (!destination.empty()) {
+        // a[i] = b[i] op c[i], a[i] = b[i] op K, a[i] op= b[i] or a[i] op= K
+        if (isAssignment) {
+            auto operand = castTo<BinaryExpression::Ptr>(rvalue);
+            if (!operand) {
+                return false;
+            }
+            operation = getVectorOperation(operand->getBinaryOperator()->getToken());
+            left = getUnitStrideArray(bbInit, operand->getLeftExpression(), loop.counter);
+            right = operand->getRightExpression();
+            if (left.empty() && operation != ir::VectorOperation::Sub) { // K op b[i]
+                left = getUnitStrideArray(bbInit, operand->getRightExpression(), loop.counter);
+                right = operand->getLeftExpression();
+            }
+        } else {
+            operation = getVectorOperation(token);
+            left = destination;
+            right = rvalue;
+        }
+        if (left.empty()) {
+            return false;
+        }
+
+    } else {
+        // s op= b[i], s = s op b[i] or s = b[i] op s
+        isReduction = true;
+        destination = getVariableName(lvalue);
+        if (destination.empty() || destination == loop.counter
+            || lvalue->getPrimaryType()->getMemoryLength() != 32 || !bbInit->hasSymbol(destination)) {
+            return false;
+        }
+        if (isAssignment) {
+            auto operand = castTo<BinaryExpression::Ptr>(rvalue);
+            if (!operand) {
+                return false;
+            }
+            operation = getVectorOperation(operand->getBinaryOperator()->getToken());
+            right = operand->getRightExpression();
+            if (getVariableName(operand->getLeftExpression()) != destination) {
+                if (operation == ir::VectorOperation::Sub
+                    || getVariableName(operand->getRightExpression()) != destination) {
+                    return false;
+                }
+                right = operand->getLeftExpression();
+            }
+        } else {
+            operation = getVectorOperation(token);
+            right = rvalue;
+        }
+    }
+    if (!operation) {
+        return false;
+    }
+
+    // The right operand is either a unit-stride array or a 32-bit constant
+    bool isRightConstant = false;
+    std::string rightName = getUnitStrideArray(bbInit, right, loop.counter);
+    if (rightName.empty()) {
+        auto const constantValue = getConstantValue(right);
+        if (isReduction || !constantValue || !fitsInt32(*constantValue)) {
+            return false;
+        }
+        isRightConstant = true;
+        rightName = std::to_string(*constantValue);
+    }
+
+    long long const lanes = bbInit->getCFG()->getConfig().targetAvx2 ? 8 : 4;
+    long long const vectorEnd = loop.begin + (loop.end - loop.begin) / lanes * lanes;
+    if (loop.begin < 0 || vectorEnd <= loop.begin) {
+        return false;
+    }
+
+    logger.debug() << "Vectorizing the for loop at line " << getLine() << " on " << loop.counter
+                   << " in [" << loop.begin << ", " << vectorEnd << "[ with " << lanes << " lanes.";
+
+    bbInit->addInstruction(utils::makeNode<ir::VectorLoopInstruction>(
+            bbInit, loop.counterType, loop.counter, bbInit->getFrame()->getNaming().newLabelName("_Fvec"),
+            loop.begin, vectorEnd, size_t(lanes), *operation, isReduction,
+            destination, left, rightName, isRightConstant
+    ));
+
+    // Only the remainder is left to the scalar loop
+    loop.begin = vectorEnd;
+    return true;
+}
+
+bool ForBlock::addUnrolledLoop(
+        ir::CFG *controlFlow,
+        CountedLoop const &loop,
+        ir::BasicBlock::Ptr &bbInit,
+        ir::BasicBlock::Ptr const &bbCond,
+        ir::BasicBlock::Ptr const &bbThen,
+        ir::BasicBlock::Ptr const &bbInc,
+        ir::BasicBlock::Ptr const &bbEnd
+) {
+    // The body must be made of expressions, which don't write the counter
+    for (auto const &statement : mBlock) {
+        if (!statement->shouldReturnAnIR() || !castTo<Expression::Ptr>(statement)) {
+            return false;
+        }
+    }
+    size_t bodySize = 0;
+    for (auto const &bb : getBlocksUntil(bbThen, bbInc)) {
+        for (auto const &instruction : bb->getInstructions()) {
+            if (instruction->getReturnName() == loop.counter
+                && instruction->getOperation() != ir::Operation::empty) {
+                return false;
+            }
+        }
+        bodySize += bb->getInstructions().size();
+    }
+
+    size_t factor = controlFlow->getConfig().unrollFactor;
+    if (factor == 0) {
+        bodySize = std::max<size_t>(1, bodySize);
+        factor = std::min(MAX_UNROLL_FACTOR, MAX_UNROLLED_BODY_SIZE / bodySize);
+    }
+    if (factor < 2) {
+        return false;
+    }
+
+    long long const tripCount = loop.end - loop.begin;
+    if (tripCount <= static_cast<long long>(factor)) {
+        logger.debug() << "Fully unrolling the for loop at line " << getLine() << " (" << tripCount << " iterations).";
+
+        for (long long i = 0; i < tripCount; ++i) {
+            addUnrolledIteration(bbInit);
+        }
+        bbInit->setExitWhenTrue(bbEnd);
+        return true;
+    }
+
+    // counter < end - (factor - 1), so that the factor next iterations are all in the loop
+    long long const unrolledEnd = loop.end - static_cast<long long>(factor) + 1;
+    if (unrolledEnd < 0) {
+        return false;
+    }
+
+    logger.debug() << "Unrolling the for loop at line " << getLine() << " by " << factor << ".";
+
+    ir::BasicBlock::Ptr bbUnrolledCond = controlFlow->generateLabeledBasicBlock("_Fucond");
+    ir::BasicBlock::Ptr bbUnrolledThen = controlFlow->generateLabeledBasicBlock("_Futhen");
+
+    bbInit->setExitWhenTrue(bbUnrolledCond);
+    bbUnrolledCond->setExitWhenTrue(bbUnrolledThen);
+    bbUnrolledCond->setExitWhenFalse(bbCond);
+    bbUnrolledThen->setExitWhenTrue(bbUnrolledCond);
+
+    bbUnrolledCond->addInstruction(utils::makeNode<ir::FlagToRegInstruction>(
+            createVarName(), bbUnrolledCond, loop.counterType,
+            loop.counter, std::to_string(unrolledEnd), ir::FlagToRegType::Less
+    ));
+    for (size_t i = 0; i < factor; ++i) {
+        addUnrolledIteration(bbUnrolledThen);
+    }
+    return true;
+}
+
+void ForBlock::addUnrolledIteration(ir::BasicBlock::Ptr &bb) {
+    for (auto const &statement : mBlock) {
+        SAFE_ADD_INSTRUCTION(statement, bb);
+    }
+    SAFE_ADD_INSTRUCTION(mStep, bb);
 }
 
 
@@ -50,6 +50,40 @@ public:
 
     ir::GetBasicBlockReturn getBasicBlock(ir::CFG *controlFlow) override;
 
+private:
+    /**
+     * A loop of the form: for (counter = begin; counter < end; counter++)
+     */
+    struct CountedLoop {
+        std::string counter;
+        PrimaryType::Ptr counterType;
+        long long begin;
+        long long end;
+    };
+
+    std::optional<CountedLoop> getCountedLoop() const;
+
+    // Returns the array name if expression is array[counter] on a local 32-bit array, "" otherwise
+    static std::string getUnitStrideArray(
+            std::shared_ptr<ir::BasicBlock> const &bb,
+            Expression::Ptr const &expression,
+            std::string const &counter
+    );
+
+    bool addVectorizedLoop(std::shared_ptr<ir::BasicBlock> const &bbInit, CountedLoop &loop);
+
+    bool addUnrolledLoop(
+            ir::CFG *controlFlow,
+            CountedLoop const &loop,
+            std::shared_ptr<ir::BasicBlock> &bbInit,
+            std::shared_ptr<ir::BasicBlock> const &bbCond,
+            std::shared_ptr<ir::BasicBlock> const &bbThen,
+            std::shared_ptr<ir::BasicBlock> const &bbInc,
+            std::shared_ptr<ir::BasicBlock> const &bbEnd
+    );
+
+    void addUnrolledIteration(std::shared_ptr<ir::BasicBlock> &bb);
+
 private:
     std::shared_ptr<caramel::ast::Expression> mBegin;
     std::shared_ptr<caramel::ast::Expression> mEnd;
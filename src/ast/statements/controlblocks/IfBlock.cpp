@@ -27,10 +27,24 @@
 #include "../../../ir/BasicBlock.h"
 #include "../../../ir/IR.h"
 #include "../../../ir/helpers/IROperatorHelper.h"
+#include "../../../ir/instructions/FlagToRegInstruction.h"
+#include "../../../ir/instructions/JumpTableInstruction.h"
+#include "../expressions/binaryexpression/BinaryExpression.h"
+#include "../../operators/binaryoperators/EqualityOperator.h"
+#include "../../../utils/Common.h"
+
+#include <algorithm>
+#include <limits>
 
 
 namespace caramel::ast {
 
+using namespace caramel::utils;
+
+static constexpr size_t MIN_SWITCH_CASES = 4;
+static constexpr size_t MAX_LINEAR_SEARCH_CASES = 3;
+static constexpr long long MAX_JUMP_TABLE_SIZE_PER_CASE = 3; // Dense if the table is at most 1/3 of holes
+
 IfBlock::IfBlock(
         std::shared_ptr<caramel::ast::Expression> const &condition,
         std::vector<std::shared_ptr<caramel::ast::Statement>> const &thenBlock,
@@ -70,10 +84,16 @@ void IfBlock::visitChildrenAstDot() {
 ir::GetBasicBlockReturn IfBlock::getBasicBlock(
         ir::CFG *controlFlow
 ) {
-    ir::BasicBlock::Ptr bbCond = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_cond");
-    ir::BasicBlock::Ptr bbThen = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_then");
-    ir::BasicBlock::Ptr bbElse = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_else");
-    ir::BasicBlock::Ptr bbEnd = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_end");
+    if (controlFlow->getConfig().optimize) {
+        if (auto switch_ = getSwitch()) {
+            return getSwitchBasicBlock(controlFlow, *switch_);
+        }
+    }
+
+    ir::BasicBlock::Ptr bbCond = controlFlow->generateLabeledBasicBlock("_cond");
+    ir::BasicBlock::Ptr bbThen = controlFlow->generateLabeledBasicBlock("_then");
+    ir::BasicBlock::Ptr bbElse = controlFlow->generateLabeledBasicBlock("_else");
+    ir::BasicBlock::Ptr bbEnd = controlFlow->generateLabeledBasicBlock("_end");
 
     bbCond->setExitWhenTrue(bbThen);
     bbThen->setExitWhenTrue(bbEnd);
@@ -138,17 +158,17 @@ ir::GetBasicBlockReturn IfBlock::getBasicBlock(
 
 //    ir::IR::Ptr jumpInstructionElse;
 //    if (ir::Operation::cmp_eq == conditionOperation) {
-//        jumpInstructionElse = std::make_shared<ir::JumpEqualInstruction>(bb, bbElseName);
+//        jumpInstructionElse = utils::makeNode<ir::JumpEqualInstruction>(bb, bbElseName);
 //    } else if (ir::Operation::cmp_lt == conditionOperation) {
-//        jumpInstructionElse = std::make_shared<ir::JumpLessInstruction>(bb, bbElseName);
+//        jumpInstructionElse = utils::makeNode<ir::JumpLessInstruction>(bb, bbElseName);
 //    } else if (ir::Operation::cmp_le == conditionOperation) {
-//        jumpInstructionElse = std::make_shared<ir::JumpLessOrEqualInstruction>(bb, bbElseName);
+//        jumpInstructionElse = utils::makeNode<ir::JumpLessOrEqualInstruction>(bb, bbElseName);
 //    } else if (ir::Operation::cmp_gt == conditionOperation) {
-//        jumpInstructionElse = std::make_shared<ir::JumpGreaterInstruction>(bb, bbElseName);
+//        jumpInstructionElse = utils::makeNode<ir::JumpGreaterInstruction>(bb, bbElseName);
 //    } else if (ir::Operation::cmp_ge == conditionOperation) {
-//        jumpInstructionElse = std::make_shared<ir::JumpGreaterOrEqualInstruction>(bb, bbElseName);
+//        jumpInstructionElse = utils::makeNode<ir::JumpGreaterOrEqualInstruction>(bb, bbElseName);
 //    } else {
-//        jumpInstructionElse = std::make_shared<ir::JumpInstruction>(bb, bbElseName); // FIXME : Should not be the case
+//        jumpInstructionElse = utils::makeNode<ir::JumpInstruction>(bb, bbElseName); // FIXME : Should not be the case
 //    }
 //    bb->addInstruction(jumpInstructionElse);
 }
@@ -157,4 +177,168 @@ bool IfBlock::shouldReturnABasicBlock() const {
     return true;
 }
 
+std::optional<std::pair<std::string, long long>> IfBlock::getEqualityTest() const {
+    // variable == constant, or constant == variable
+    auto condition = castTo<BinaryExpression::Ptr>(mCondition);
+    if (!condition || condition->getBinaryOperator()->getToken() != EqualityOperator::SYMBOL) {
+        return {};
+    }
+    std::string variable = getVariableName(condition->getLeftExpression());
+    auto value = getConstantValue(condition->getRightExpression());
+    if (variable.empty()) {
+        variable = getVariableName(condition->getRightExpression());
+        value = getConstantValue(condition->getLeftExpression());
+    }
+    if (variable.empty() || !value
+        || *value < std::numeric_limits<int32_t>::min() || *value > std::numeric_limits<int32_t>::max()) {
+        return {};
+    }
+    return std::make_pair(variable, *value);
+}
+
+std::optional<IfBlock::Switch> IfBlock::getSwitch() const {
+    auto const test = getEqualityTest();
+    if (!test) {
+        return {};
+    }
+
+    auto condition = castTo<BinaryExpression::Ptr>(mCondition);
+    Switch switch_{test->first, PrimaryType::max(
+            condition->getLeftExpression()->getPrimaryType(),
+            condition->getRightExpression()->getPrimaryType()
+    ), {{test->second, &mThenBlock, nullptr}}, &mElseBlock};
+
+    // Follow the else if chain, as long as the same variable is tested
+    while (switch_.defaultBlock->size() == 1) {
+        auto elseIf = castTo<IfBlock::Ptr>(switch_.defaultBlock->front());
+        if (!elseIf) {
+            break;
+        }
+        auto const elseIfTest = elseIf->getEqualityTest();
+        if (!elseIfTest || elseIfTest->first != switch_.variable) {
+            break;
+        }
+        switch_.cases.push_back({elseIfTest->second, &elseIf->mThenBlock, nullptr});
+        switch_.defaultBlock = &elseIf->mElseBlock;
+    }
+
+    // Only the first test of a value is ever true
+    std::stable_sort(switch_.cases.begin(), switch_.cases.end(), [](SwitchCase const &a, SwitchCase const &b) {
+        return a.value < b.value;
+    });
+    switch_.cases.erase(std::unique(switch_.cases.begin(), switch_.cases.end(),
+                                    [](SwitchCase const &a, SwitchCase const &b) {
+                                        return a.value == b.value;
+                                    }), switch_.cases.end());
+
+    if (switch_.cases.size() < MIN_SWITCH_CASES) {
+        return {};
+    }
+    return switch_;
+}
+
+ir::GetBasicBlockReturn IfBlock::getSwitchBasicBlock(ir::CFG *controlFlow, Switch &switch_) {
+    ir::BasicBlock::Ptr bbSwitch = controlFlow->generateLabeledBasicBlock("_switch");
+    ir::BasicBlock::Ptr bbDefault = controlFlow->generateLabeledBasicBlock("_default");
+    ir::BasicBlock::Ptr bbEnd = controlFlow->generateLabeledBasicBlock("_end");
+
+    // CASE BBs
+    for (auto &case_ : switch_.cases) {
+        case_.basicBlock = controlFlow->generateLabeledBasicBlock("_case");
+        case_.basicBlock->setExitWhenTrue(bbEnd);
+        addStatements(controlFlow, *case_.block, case_.basicBlock, "_caseafter");
+    }
+
+    // DEFAULT BB
+    bbDefault->setExitWhenTrue(bbEnd);
+    addStatements(controlFlow, *switch_.defaultBlock, bbDefault, "_defaultafter");
+
+    long long const minimum = switch_.cases.front().value;
+    long long const tableSize = switch_.cases.back().value - minimum + 1;
+    long long const nbCases = static_cast<long long>(switch_.cases.size());
+
+    if (tableSize <= nbCases * MAX_JUMP_TABLE_SIZE_PER_CASE) {
+        // Dense: bounds check and indirect jump
+        logger.debug() << "Lowering the if chain at line " << getLine() << " on " << switch_.variable
+                       << " to a jump table of " << tableSize << " entries.";
+
+        std::vector<ir::BasicBlock::Ptr> targets(size_t(tableSize), bbDefault);
+        for (auto const &case_ : switch_.cases) {
+            targets[size_t(case_.value - minimum)] = case_.basicBlock;
+            bbSwitch->addJumpTarget(case_.basicBlock);
+        }
+        bbSwitch->addJumpTarget(bbDefault);
+
+        bbSwitch->addInstruction(utils::makeNode<ir::JumpTableInstruction>(
+                bbSwitch, switch_.type, switch_.variable,
+                bbSwitch->getFrame()->getNaming().newLabelName("_table"), minimum, targets, bbDefault
+        ));
+    } else {
+        // Sparse: balanced binary search
+        logger.debug() << "Lowering the if chain at line " << getLine() << " on " << switch_.variable
+                       << " to a binary search on " << nbCases << " cases.";
+
+        bbSwitch->setExitWhenTrue(getSearchBasicBlock(controlFlow, switch_, 0, switch_.cases.size(), bbDefault));
+    }
+
+    return {bbSwitch, bbEnd};
+}
+
+ir::BasicBlock::Ptr IfBlock::getSearchBasicBlock(
+        ir::CFG *controlFlow,
+        Switch const &switch_,
+        size_t begin,
+        size_t end,
+        ir::BasicBlock::Ptr const &bbDefault
+) {
+    if (end - begin <= MAX_LINEAR_SEARCH_CASES) {
+        ir::BasicBlock::Ptr bbNext = bbDefault;
+        for (size_t i = end; i-- > begin;) {
+            ir::BasicBlock::Ptr bbTest = controlFlow->generateLabeledBasicBlock(
+                    "_seq");
+            bbTest->addInstruction(utils::makeNode<ir::FlagToRegInstruction>(
+                    createVarName(), bbTest, switch_.type,
+                    switch_.variable, std::to_string(switch_.cases[i].value), ir::FlagToRegType::Equal
+            ));
+            bbTest->setExitWhenTrue(switch_.cases[i].basicBlock);
+            bbTest->setExitWhenFalse(bbNext);
+            bbNext = bbTest;
+        }
+        return bbNext;
+    }
+
+    size_t const middle = begin + (end - begin) / 2;
+    ir::BasicBlock::Ptr bbTest = controlFlow->generateLabeledBasicBlock("_slt");
+    bbTest->addInstruction(utils::makeNode<ir::FlagToRegInstruction>(
+            createVarName(), bbTest, switch_.type,
+            switch_.variable, std::to_string(switch_.cases[middle].value), ir::FlagToRegType::Less
+    ));
+    bbTest->setExitWhenTrue(getSearchBasicBlock(controlFlow, switch_, begin, middle, bbDefault));
+    bbTest->setExitWhenFalse(getSearchBasicBlock(controlFlow, switch_, middle, end, bbDefault));
+    return bbTest;
+}
+
+void IfBlock::addStatements(
+        ir::CFG *controlFlow,
+        std::vector<Statement::Ptr> const &statements,
+        ir::BasicBlock::Ptr bb,
+        std::string const &afterSuffix
+) {
+    for (auto const &statement : statements) {
+        if (statement->shouldReturnAnIR()) {
+            SAFE_ADD_INSTRUCTION(statement, bb);
+        } else if (statement->shouldReturnABasicBlock()) {
+            auto [begin, end] = statement->getBasicBlock(controlFlow);
+
+            end->setExitWhenTrue(bb->getNextWhenTrue());
+            // bb has no when_false
+
+            bb->setExitWhenTrue(begin);
+            // bb has no when_false
+
+            bb = end->getNewWhenTrueBasicBlock(afterSuffix);
+        }
+    }
+}
+
 } // namespace caramel::ast
@@ -51,6 +51,43 @@ public:
 
     ir::GetBasicBlockReturn getBasicBlock(ir::CFG *controlFlow) override;
 
+private:
+    /**
+     * An if / else if chain testing the same variable against constants.
+     */
+    struct SwitchCase {
+        long long value;
+        std::vector<std::shared_ptr<Statement>> const *block;
+        std::shared_ptr<ir::BasicBlock> basicBlock;
+    };
+    struct Switch {
+        std::string variable;
+        PrimaryType::Ptr type;
+        std::vector<SwitchCase> cases;
+        std::vector<std::shared_ptr<Statement>> const *defaultBlock;
+    };
+
+    std::optional<std::pair<std::string, long long>> getEqualityTest() const;
+
+    std::optional<Switch> getSwitch() const;
+
+    ir::GetBasicBlockReturn getSwitchBasicBlock(ir::CFG *controlFlow, Switch &switch_);
+
+    std::shared_ptr<ir::BasicBlock> getSearchBasicBlock(
+            ir::CFG *controlFlow,
+            Switch const &switch_,
+            size_t begin,
+            size_t end,
+            std::shared_ptr<ir::BasicBlock> const &bbDefault
+    );
+
+    static void addStatements(
+            ir::CFG *controlFlow,
+            std::vector<std::shared_ptr<Statement>> const &statements,
+            std::shared_ptr<ir::BasicBlock> bb,
+            std::string const &afterSuffix
+    );
+
 private:
     std::shared_ptr<caramel::ast::Expression> mCondition;
     std::vector<
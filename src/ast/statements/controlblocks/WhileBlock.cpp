@@ -59,9 +59,9 @@ void WhileBlock::visitChildrenAstDot() {
 ir::GetBasicBlockReturn WhileBlock::getBasicBlock(
         ir::CFG *controlFlow
 ) {
-    ir::BasicBlock::Ptr bbWcond = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Wcond");
-    ir::BasicBlock::Ptr bbWthen = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Wthen");
-    ir::BasicBlock::Ptr bbWend = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_Wend");
+    ir::BasicBlock::Ptr bbWcond = controlFlow->generateLabeledBasicBlock("_Wcond");
+    ir::BasicBlock::Ptr bbWthen = controlFlow->generateLabeledBasicBlock("_Wthen");
+    ir::BasicBlock::Ptr bbWend = controlFlow->generateLabeledBasicBlock("_Wend");
 
     controlFlow->pushCurrentControlBlockEndBB(bbWend);
 
@@ -39,6 +39,10 @@ caramel::ast::VariableSymbol::WeakPtr VariableDeclaration::getVariableSymbol() {
     return mSymbol;
 }
 
+void VariableDeclaration::setVariableSymbol(std::shared_ptr<VariableSymbol> variableSymbol) {
+    mSymbol = variableSymbol;
+}
+
 void VariableDeclaration::acceptAstDotVisit() {
     addNode(thisId(), "VariableDeclaration: " + mSymbol.lock()->getName());
     addEdge(thisId(), mSymbol.lock()->thisId());
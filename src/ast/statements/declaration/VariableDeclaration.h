@@ -44,6 +44,8 @@ public:
 
     VariableSymbol::WeakPtr getVariableSymbol();
 
+    void setVariableSymbol(std::shared_ptr<VariableSymbol> variableSymbol);
+
     void acceptAstDotVisit() override;
 
 private:
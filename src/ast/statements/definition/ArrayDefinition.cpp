@@ -30,14 +30,16 @@
 #include "../../../ir/BasicBlock.h"
 #include "../../../ir/instructions/CopyInstruction.h"
 #include "../../../ir/instructions/NopInstruction.h"
+#include "../../../ir/instructions/ArrayInitInstruction.h"
 #include "../../../ir/helpers/IROperatorHelper.h"
 
 
 namespace caramel::ast {
 
+static constexpr long MIN_BULK_INIT_LENGTH = 8;
+
 ArrayDefinition::ArrayDefinition(antlr4::Token *startToken)
-        : Definition(startToken, StatementType::ArrayDefinition),
-          mStartToken{startToken}, mSymbol{} {}
+        : Definition(startToken, StatementType::ArrayDefinition), mSymbol{} {}
 
 std::weak_ptr<caramel::ast::Symbol> ArrayDefinition::getSymbol() {
     return mSymbol;
@@ -71,17 +73,40 @@ std::shared_ptr<ir::IR> ArrayDefinition::getIR(ir::BasicBlock::Ptr &currentBasic
 
     currentBasicBlock->addArraySymbol(arrayName, arrayType, arraySymbol->getSize());
 
+    // Big arrays get their constant elements all at once, the others are copied one by one
+    bool const bulkInit = arraySymbol->getSize() >= MIN_BULK_INIT_LENGTH;
+    if (bulkInit) {
+        std::vector<long long> values;
+        for (auto const &expression : content) {
+            values.push_back(expression->getConstantValue().value_or(0));
+        }
+        while (!values.empty() && values.back() == 0) {
+            values.pop_back();
+        }
+        currentBasicBlock->addInstruction(utils::makeNode<ir::ArrayInitInstruction>(
+                currentBasicBlock,
+                arrayType,
+                arrayName,
+                currentBasicBlock->getFrame()->getNaming().newLabelName("_init"),
+                size_t(arraySymbol->getSize()),
+                std::move(values)
+        ));
+    }
+
     long index = arraySymbol->getSize();
     for (auto it = content.rbegin(), it_end = content.rend(); it != it_end; ++it) {
         auto const &expression = *it;
         --index;
+        if (bulkInit && expression->getConstantValue()) {
+            continue;
+        }
 
         std::string valueName = SAFE_ADD_INSTRUCTION(expression, currentBasicBlock);
         std::string destination = arrayName;
         if (index > 0) {
             destination += "[" + std::to_string(index) + "]";
         }
-        currentBasicBlock->addInstruction(std::make_shared<ir::CopyInstruction>(
+        currentBasicBlock->addInstruction(utils::makeNode<ir::CopyInstruction>(
                 currentBasicBlock,
                 arrayType,
                 destination,
@@ -89,7 +114,7 @@ std::shared_ptr<ir::IR> ArrayDefinition::getIR(ir::BasicBlock::Ptr &currentBasic
         ));
     }
 
-    return std::make_shared<ir::NopInstruction>(currentBasicBlock);
+    return utils::makeNode<ir::NopInstruction>(currentBasicBlock);
 }
 
 } // namespace caramel::ast
@@ -48,7 +48,6 @@ public:
     std::shared_ptr<ir::IR> getIR(std::shared_ptr<caramel::ir::BasicBlock> &currentBasicBlock) override;
 
 private:
-    antlr4::Token *mStartToken;
     std::weak_ptr<ArraySymbol> mSymbol;
 };
 
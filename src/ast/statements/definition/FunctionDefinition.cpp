@@ -64,8 +64,8 @@ ir::GetBasicBlockReturn FunctionDefinition::getBasicBlock(
 ) {
     ir::BasicBlock::Ptr function_root_bb = controlFlow->generateFunctionBlock(mSymbol->getName());
 
-    controlFlow->enterFunction(function_root_bb->getId());
-    function_root_bb->addInstruction(std::make_shared<ir::PrologInstruction>(function_root_bb));
+    controlFlow->enterFunction(function_root_bb->getFunctionContext());
+    function_root_bb->addInstruction(utils::makeNode<ir::PrologInstruction>(function_root_bb));
 
     auto parameters = mSymbol->getParameters();
     for (size_t i = 0; i < parameters.size(); i++) {
@@ -82,7 +82,7 @@ ir::GetBasicBlockReturn FunctionDefinition::getBasicBlock(
 
         if (i < 6) {
             function_root_bb->addInstruction(
-                    std::make_shared<ir::CopyInstruction>(function_root_bb, parameters[i].primaryType,
+                    utils::makeNode<ir::CopyInstruction>(function_root_bb, parameters[i].primaryType,
                                                           parameters[i].name, i)
             );
         } else {
@@ -90,7 +90,7 @@ ir::GetBasicBlockReturn FunctionDefinition::getBasicBlock(
         }
     }
 
-    ir::BasicBlock::Ptr function_end_bb = controlFlow->generateBasicBlock(ir::BasicBlock::getNextNumberName() + "_endof_" + mSymbol->getName());
+    ir::BasicBlock::Ptr function_end_bb = controlFlow->generateLabeledBasicBlock("_endof_" + mSymbol->getName());
     function_root_bb->setExitWhenTrue(function_end_bb);
 
     controlFlow->addFunctionBBEnd(function_root_bb->getFunctionContext(),function_end_bb);
@@ -114,8 +114,8 @@ ir::GetBasicBlockReturn FunctionDefinition::getBasicBlock(
         }
     }
 
-    function_end_bb->addInstruction(std::make_shared<ir::EpilogInstruction>(function_root_bb));
-    controlFlow->leaveFunction(function_root_bb->getId());
+    function_end_bb->addInstruction(utils::makeNode<ir::EpilogInstruction>(function_root_bb));
+    controlFlow->leaveFunction(function_root_bb->getFunctionContext());
 
     return {function_root_bb, function_end_bb};
 }
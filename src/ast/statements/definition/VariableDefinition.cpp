@@ -56,6 +56,10 @@ void VariableDefinition::setVariableSymbol(std::shared_ptr<VariableSymbol> varia
     mSymbol = variableSymbol;
 }
 
+std::shared_ptr<Expression> VariableDefinition::getInitializer() const {
+    return mInitializer;
+}
+
 void VariableDefinition::acceptAstDotVisit() {
     addNode(thisId(), "VariableDefinition: " + mSymbol.lock()->getName());
     addEdge(thisId(), mSymbol.lock()->thisId());
@@ -76,8 +80,12 @@ std::shared_ptr<ir::IR> VariableDefinition::getIR(std::shared_ptr<ir::BasicBlock
 //    auto ir = mInitializer->getIR(currentBasicBlock);
     std::string opName = SAFE_ADD_INSTRUCTION(mInitializer, currentBasicBlock); // currentBasicBlock->addInstruction(ir);
     std::string identifier = mSymbol.lock()->getName();
+    if (currentBasicBlock->isSymbolGlobal(identifier)) {
+        // Shadows the global variable
+        currentBasicBlock->addSymbol(identifier, mSymbol.lock()->getType());
+    }
 
-    return std::make_shared<ir::CopyInstruction>(
+    return utils::makeNode<ir::CopyInstruction>(
             currentBasicBlock,
             mSymbol.lock()->getType(),
             identifier,
@@ -50,6 +50,8 @@ public:
     std::weak_ptr<VariableSymbol> getVariableSymbol();
     void setVariableSymbol(std::shared_ptr<VariableSymbol> variableSymbol);
 
+    std::shared_ptr<Expression> getInitializer() const;
+
     void acceptAstDotVisit() override;
 
     bool shouldReturnAnIR() const override;
@@ -53,7 +53,7 @@ std::shared_ptr<ir::IR> CommaExpression::getIR(std::shared_ptr<ir::BasicBlock> &
         exprLocation = SAFE_ADD_INSTRUCTION(expression, currentBasicBlock);
     }
 
-    return std::make_shared<ir::EmptyInstruction>(
+    return utils::makeNode<ir::EmptyInstruction>(
             exprLocation,
             currentBasicBlock,
             mExpressions.back()->getPrimaryType()
@@ -30,4 +30,8 @@ Expression::Expression(antlr4::Token *startToken, StatementType type)
         : Statement(startToken, type) {
 }
 
+std::optional<long long> Expression::getConstantValue() const {
+    return {};
+}
+
 } // namespace caramel::ast
@@ -29,6 +29,7 @@
 #include "../../../exceptions/NotImplementedException.h"
 
 #include <memory>
+#include <optional>
 
 
 namespace caramel::ast {
@@ -43,6 +44,11 @@ public:
     ~Expression() override  = default;
 
     virtual PrimaryType::Ptr getPrimaryType() const = 0;
+
+    /**
+     * The value of this expression, if it can be computed at compile time.
+     */
+    virtual std::optional<long long> getConstantValue() const;
 };
 
 } // namespace caramel::ast
@@ -72,14 +72,28 @@ bool ArrayAccess::shouldReturnAnIR() const {
 
 std::shared_ptr<ir::IR> ArrayAccess::getIR(std::shared_ptr<caramel::ir::BasicBlock> &currentBasicBlock) {
 
-    std::string indexSrc = SAFE_ADD_INSTRUCTION(mIndex, currentBasicBlock);
+    mLoweredIndex = SAFE_ADD_INSTRUCTION(mIndex, currentBasicBlock);
 
-    return std::make_shared<ir::ArrayAccessInstruction>(
+    return utils::makeNode<ir::ArrayAccessInstruction>(
             currentBasicBlock, mSymbol->getType(),
             createVarName(),
-            indexSrc, mIndex->getPrimaryType(),
+            mLoweredIndex, mIndex->getPrimaryType(),
             mSymbol->getName()
     );
 }
 
+std::shared_ptr<ir::IR> ArrayAccess::getAssignmentIR(
+        std::shared_ptr<ir::BasicBlock> &currentBasicBlock,
+        PrimaryType::Ptr const &type,
+        std::string const &source
+) {
+    return utils::makeNode<ir::ArrayAccessInstruction>(
+            currentBasicBlock, type,
+            createVarName(),
+            mLoweredIndex, mIndex->getPrimaryType(),
+            mSymbol->getName(),
+            true, source
+    );
+}
+
 } // namespace caramel::ast
@@ -56,12 +56,19 @@ public:
 
     std::shared_ptr<ir::IR> getIR(std::shared_ptr<caramel::ir::BasicBlock> &currentBasicBlock) override;
 
+    std::shared_ptr<ir::IR> getAssignmentIR(
+            std::shared_ptr<ir::BasicBlock> &currentBasicBlock,
+            PrimaryType::Ptr const &type,
+            std::string const &source
+    ) override;
+
     void acceptAstDotVisit() override;
     void visitChildrenAstDot() override;
 
 private:
     Symbol::Ptr mSymbol;
     Expression::Ptr mIndex;
+    std::string mLoweredIndex; // Where getIR() left the index, for getAssignmentIR()
 };
 
 } // namespace caramel::ast
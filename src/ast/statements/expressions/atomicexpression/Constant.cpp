@@ -50,6 +50,10 @@ PrimaryType::Ptr Constant::getPrimaryType() const {
     }
 }
 
+std::optional<long long> Constant::getConstantValue() const {
+    return mValue;
+}
+
 void Constant::acceptAstDotVisit() {
     addNode(thisId(), "Constant: " + std::to_string(mValue));
 }
@@ -64,10 +68,10 @@ std::shared_ptr<ir::IR> Constant::getIR(std::shared_ptr<ir::BasicBlock> &current
     std::string tempVar = createVarName();
     std::string constValue = std::to_string(getValue());
     // Todo: check if Int64_t for constant is good or not
-    return std::make_shared<ir::LDConstInstruction>(
+    return utils::makeNode<ir::LDConstInstruction>(
             currentBasicBlock, Int64_t::Create(), tempVar, constValue);
 
-//    return std::make_shared<ir::EmptyInstruction>(
+//    return utils::makeNode<ir::EmptyInstruction>(
 //            std::to_string(getValue()), currentBasicBlock, Int64_t::Create());
 }
 
@@ -35,7 +35,7 @@ public:
     using WeakPtr = std::weak_ptr<Constant>;
 
     static Ptr defaultConstant(antlr4::Token *startToken) {
-        return std::make_shared<Constant>(0L, startToken);
+        return utils::makeNode<Constant>(0L, startToken);
     }
 
 public:
@@ -45,6 +45,7 @@ public:
     long long getValue() const;
 
     PrimaryType::Ptr getPrimaryType() const override;
+    std::optional<long long> getConstantValue() const override;
 
     void acceptAstDotVisit() override;
     void visitChildrenAstDot() override;
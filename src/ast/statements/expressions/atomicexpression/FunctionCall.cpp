@@ -82,12 +82,12 @@ std::shared_ptr<ir::IR> FunctionCall::getIR(std::shared_ptr<ir::BasicBlock> &cur
         std::string callParameterValue = SAFE_ADD_INSTRUCTION(mArguments[i], currentBasicBlock);
         bool isAddress = mArguments[i]->getType() == StatementType::Identifier
                          && castTo<ast::Identifier::Ptr>(mArguments[i])->isAddress();
-        currentBasicBlock->addInstruction(std::make_shared<ir::CallParameterInstruction>(
+        currentBasicBlock->addInstruction(utils::makeNode<ir::CallParameterInstruction>(
                 currentBasicBlock, i, mArguments[i]->getPrimaryType(), callParameterValue, isAddress
         ));
     }
 
-    return std::make_shared<ir::FunctionCallInstruction>(
+    return utils::makeNode<ir::FunctionCallInstruction>(
             functionName,
             currentBasicBlock,
             functionSymbol->getType(),
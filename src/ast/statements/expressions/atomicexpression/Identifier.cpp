@@ -27,6 +27,7 @@
 #include "../../../../ir/instructions/EmptyInstruction.h"
 #include "../../../../ir/instructions/NopInstruction.h"
 #include "../../../../ir/instructions/CopyAddrInstruction.h"
+#include "../../../../ir/instructions/CopyInstruction.h"
 #include "../../../../utils/Common.h"
 
 
@@ -54,14 +55,22 @@ bool Identifier::isAddress() const {
 std::shared_ptr<ir::IR> Identifier::getIR(std::shared_ptr<ir::BasicBlock> &currentBasicBlock) {
     if (isAddress()) {
         auto arraySymbol = utils::castTo<ArraySymbol::Ptr>(mSymbol);
-        return std::make_shared<ir::CopyAddrInstruction>(
+        return utils::makeNode<ir::CopyAddrInstruction>(
                 currentBasicBlock, createVarName(), arraySymbol->getName(), arraySymbol->isContentDefined()
         );
     } else {
-        return std::make_shared<ir::EmptyInstruction>(mSymbol->getName(), currentBasicBlock, mSymbol->getType());
+        return utils::makeNode<ir::EmptyInstruction>(mSymbol->getName(), currentBasicBlock, mSymbol->getType());
     }
 }
 
+std::shared_ptr<ir::IR> Identifier::getAssignmentIR(
+        std::shared_ptr<ir::BasicBlock> &currentBasicBlock,
+        PrimaryType::Ptr const &type,
+        std::string const &source
+) {
+    return utils::makeNode<ir::CopyInstruction>(currentBasicBlock, type, mSymbol->getName(), source);
+}
+
 bool Identifier::shouldReturnAnIR() const {
     return true;
 }
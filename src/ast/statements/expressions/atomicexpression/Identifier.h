@@ -48,6 +48,12 @@ public:
 
     std::shared_ptr<ir::IR> getIR(std::shared_ptr<caramel::ir::BasicBlock> &currentBasicBlock) override;
 
+    std::shared_ptr<ir::IR> getAssignmentIR(
+            std::shared_ptr<ir::BasicBlock> &currentBasicBlock,
+            PrimaryType::Ptr const &type,
+            std::string const &source
+    ) override;
+
     bool shouldReturnAnIR() const override;
 
     void acceptAstDotVisit() override;
@@ -45,6 +45,16 @@ public:
 
     virtual Symbol::Ptr getSymbol() const = 0;
 
+    /**
+     * Writes source back to the lvalue, after getIR() read it in a compound assignment.
+     * The index of an array access is not lowered a second time.
+     */
+    virtual std::shared_ptr<ir::IR> getAssignmentIR(
+            std::shared_ptr<ir::BasicBlock> &currentBasicBlock,
+            PrimaryType::Ptr const &type,
+            std::string const &source
+    ) = 0;
+
 private:
     bool mIsUsedAsLeftValue;
 };
@@ -23,6 +23,22 @@
 */
 
 #include "BinaryExpression.h"
+#include "../../../operators/binaryoperators/PlusOperator.h"
+#include "../../../operators/binaryoperators/MinusOperator.h"
+#include "../../../operators/binaryoperators/MultOperator.h"
+#include "../../../operators/binaryoperators/DivOperator.h"
+#include "../../../operators/binaryoperators/ModOperator.h"
+#include "../../../operators/binaryoperators/BitwiseAndOperator.h"
+#include "../../../operators/binaryoperators/BitwiseOrOperator.h"
+#include "../../../operators/binaryoperators/BitwiseXorOperator.h"
+#include "../../../operators/binaryoperators/LeftShiftOperator.h"
+#include "../../../operators/binaryoperators/RightShiftOperator.h"
+#include "../../../operators/binaryoperators/EqualityOperator.h"
+#include "../../../operators/binaryoperators/NotEqOperator.h"
+#include "../../../operators/binaryoperators/LowerThanOperator.h"
+#include "../../../operators/binaryoperators/LowerEqThanOperator.h"
+#include "../../../operators/binaryoperators/GreaterThanOperator.h"
+#include "../../../operators/binaryoperators/GreaterEqThanOperator.h"
 
 
 namespace caramel::ast {
@@ -37,6 +53,18 @@ BinaryExpression::BinaryExpression(
     mBinaryOperator{binaryOperator},
     mRightExpression{rightExpression} {}
 
+std::shared_ptr<Expression> BinaryExpression::getLeftExpression() const {
+    return mLeftExpression;
+}
+
+std::shared_ptr<BinaryOperator> BinaryExpression::getBinaryOperator() const {
+    return mBinaryOperator;
+}
+
+std::shared_ptr<Expression> BinaryExpression::getRightExpression() const {
+    return mRightExpression;
+}
+
 std::shared_ptr<ir::IR>
 BinaryExpression::getIR(
         std::shared_ptr<ir::BasicBlock> &currentBasicBlock
@@ -60,6 +88,35 @@ PrimaryType::Ptr BinaryExpression::getPrimaryType() const {
     return PrimaryType::max(mLeftExpression->getPrimaryType(), mRightExpression->getPrimaryType());
 }
 
+std::optional<long long> BinaryExpression::getConstantValue() const {
+    auto const left = mLeftExpression->getConstantValue();
+    auto const right = mRightExpression->getConstantValue();
+    if (!left || !right) {
+        return {};
+    }
+    long long const l = *left;
+    long long const r = *right;
+    std::string const token = mBinaryOperator->getToken();
+
+    if (token == PlusOperator::SYMBOL) { return l + r; }
+    if (token == MinusOperator::SYMBOL) { return l - r; }
+    if (token == MultOperator::SYMBOL) { return l * r; }
+    if (token == DivOperator::SYMBOL) { return r != 0 ? std::optional<long long>(l / r) : std::nullopt; }
+    if (token == ModOperator::SYMBOL) { return r != 0 ? std::optional<long long>(l % r) : std::nullopt; }
+    if (token == BitwiseAndOperator::SYMBOL) { return l & r; }
+    if (token == BitwiseOrOperator::SYMBOL) { return l | r; }
+    if (token == BitwiseXorOperator::SYMBOL) { return l ^ r; }
+    if (token == LeftShiftOperator::SYMBOL) { return r >= 0 && r < 64 ? std::optional<long long>(l << r) : std::nullopt; }
+    if (token == RightShiftOperator::SYMBOL) { return r >= 0 && r < 64 ? std::optional<long long>(l >> r) : std::nullopt; }
+    if (token == EqualityOperator::SYMBOL) { return l == r; }
+    if (token == NotEqOperator::SYMBOL) { return l != r; }
+    if (token == LowerThanOperator::SYMBOL) { return l < r; }
+    if (token == LowerEqThanOperator::SYMBOL) { return l <= r; }
+    if (token == GreaterThanOperator::SYMBOL) { return l > r; }
+    if (token == GreaterEqThanOperator::SYMBOL) { return l >= r; }
+    return {};
+}
+
 void BinaryExpression::acceptAstDotVisit() {
     addNode(thisId(), "BinaryExpression: " + std::string(mBinaryOperator->getToken()));
     visitChildrenAstDot();
@@ -43,6 +43,10 @@ public:
     );
     ~BinaryExpression() override = default;
 
+    std::shared_ptr<Expression> getLeftExpression() const;
+    std::shared_ptr<BinaryOperator> getBinaryOperator() const;
+    std::shared_ptr<Expression> getRightExpression() const;
+
     bool shouldReturnAnIR() const override;
 
     std::shared_ptr<caramel::ir::IR> getIR(
@@ -50,6 +54,7 @@ public:
     ) override;
 
     PrimaryType::Ptr getPrimaryType() const override;
+    std::optional<long long> getConstantValue() const override;
 
     void visitChildrenAstDot() override;
     void acceptAstDotVisit() override;
@@ -23,6 +23,8 @@
 */
 
 #include "UnaryExpression.h"
+#include "../../../operators/prefixoperators/PreNegOperator.h"
+#include "../../../operators/prefixoperators/LogicalNotOperator.h"
 
 
 namespace caramel::ast {
@@ -35,6 +37,14 @@ UnaryExpression::UnaryExpression(
     mInnerExpression{innerExpression},
     mUnaryOperator{unaryOperator} {}
 
+std::shared_ptr<Expression> UnaryExpression::getInnerExpression() const {
+    return mInnerExpression;
+}
+
+std::shared_ptr<UnaryOperator> UnaryExpression::getUnaryOperator() const {
+    return mUnaryOperator;
+}
+
 std::shared_ptr<caramel::ir::IR>
 UnaryExpression::getIR(
         std::shared_ptr<ir::BasicBlock> &currentBasicBlock
@@ -56,6 +66,20 @@ PrimaryType::Ptr UnaryExpression::getPrimaryType() const {
     return mInnerExpression->getPrimaryType();
 }
 
+std::optional<long long> UnaryExpression::getConstantValue() const {
+    auto const value = mInnerExpression->getConstantValue();
+    if (!value) {
+        return {};
+    }
+    std::string const token = mUnaryOperator->getToken();
+    if (token == PreNegOperator::SYMBOL) {
+        return -*value;
+    } else if (token == LogicalNotOperator::SYMBOL) {
+        return *value == 0 ? 1 : 0;
+    }
+    return {};
+}
+
 bool UnaryExpression::shouldReturnAnIR() const {
     return true;
 }
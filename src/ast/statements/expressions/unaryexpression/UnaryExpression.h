@@ -43,7 +43,11 @@ public:
     );
     ~UnaryExpression() override = default;
 
+    std::shared_ptr<Expression> getInnerExpression() const;
+    std::shared_ptr<UnaryOperator> getUnaryOperator() const;
+
     PrimaryType::Ptr getPrimaryType() const override;
+    std::optional<long long> getConstantValue() const override;
 
     bool shouldReturnAnIR() const override;
 
@@ -43,7 +43,7 @@ bool BreakStatement::shouldReturnAnIR() const {
 }
 
 std::shared_ptr<ir::IR> BreakStatement::getIR(std::shared_ptr<ir::BasicBlock> &currentBasicBlock) {
-    return std::make_shared<ir::BreakInstruction>(
+    return utils::makeNode<ir::BreakInstruction>(
             currentBasicBlock,
             currentBasicBlock->getCFG()->getCurrentControlBlockEndBB()->getLabelName()
     );
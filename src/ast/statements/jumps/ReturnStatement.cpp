@@ -58,10 +58,10 @@ bool ReturnStatement::shouldReturnAnIR() const {
 std::shared_ptr<ir::IR> ReturnStatement::getIR(std::shared_ptr<ir::BasicBlock> &currentBasicBlock) {
     if (mExpression) {
         std::string value = SAFE_ADD_INSTRUCTION(mExpression, currentBasicBlock); // currentBasicBlock->addInstruction(mExpression->getIR(currentBasicBlock));
-        return std::make_shared<ir::ReturnInstruction>(
+        return utils::makeNode<ir::ReturnInstruction>(
                 currentBasicBlock, mExpression->getPrimaryType(), value);
     } else {
-        return std::make_shared<ir::ReturnInstruction>(currentBasicBlock);
+        return utils::makeNode<ir::ReturnInstruction>(currentBasicBlock);
     }
 }
 
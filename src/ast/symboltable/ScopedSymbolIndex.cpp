@@ -0,0 +1,148 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "ScopedSymbolIndex.h"
+
+
+namespace caramel::ast {
+
+static constexpr utils::SymbolId EMPTY_SLOT = UINT32_MAX;
+static constexpr int32_t NO_BINDING = -1;
+static constexpr size_t INITIAL_SLOTS = 256;
+
+static size_t hashSymbolId(utils::SymbolId id, size_t mask) {
+    // Ids are sequential, so spread them with a Fibonacci multiplier
+    return (id * 2654435769u) & mask;
+}
+
+ScopedSymbolIndex::ScopedSymbolIndex()
+        : mSlots(INITIAL_SLOTS, Slot{EMPTY_SLOT, NO_BINDING}),
+          mUsedSlots{0} {}
+
+void ScopedSymbolIndex::bind(utils::SymbolId id, size_t depth, Symbol::Ptr const &symbol) {
+    Slot &slot = findSlot(id);
+
+    // Walk past the bindings of deeper scopes, to keep the chain sorted
+    int32_t *link = &slot.head;
+    while (*link != NO_BINDING && mBindings[*link].depth > depth) {
+        link = &mBindings[*link].shadowed;
+    }
+    if (*link != NO_BINDING && mBindings[*link].depth == depth) {
+        mBindings[*link].symbol = symbol;
+        return;
+    }
+
+    Binding binding{symbol, id, uint32_t(depth), *link};
+    int32_t index;
+    if (mFreeBindings.empty()) {
+        index = int32_t(mBindings.size());
+        mBindings.push_back(std::move(binding));
+    } else {
+        index = mFreeBindings.back();
+        mFreeBindings.pop_back();
+        mBindings[index] = std::move(binding);
+    }
+    *link = index;
+}
+
+void ScopedSymbolIndex::unbind(utils::SymbolId id, size_t depth) {
+    Slot &slot = findSlot(id);
+
+    int32_t *link = &slot.head;
+    while (*link != NO_BINDING && mBindings[*link].depth > depth) {
+        link = &mBindings[*link].shadowed;
+    }
+    if (*link != NO_BINDING && mBindings[*link].depth == depth) {
+        int32_t const index = *link;
+        *link = mBindings[index].shadowed;
+        mBindings[index].symbol.reset();
+        mFreeBindings.push_back(index);
+    }
+}
+
+ScopedSymbolIndex::Binding const *ScopedSymbolIndex::lookup(utils::SymbolId id, size_t depth) const {
+    Slot const *slot = findSlot(id);
+    if (!slot) {
+        return nullptr;
+    }
+
+    int32_t index = slot->head;
+    while (index != NO_BINDING && mBindings[index].depth > depth) {
+        index = mBindings[index].shadowed;
+    }
+    return index == NO_BINDING ? nullptr : &mBindings[index];
+}
+
+ScopedSymbolIndex::Binding const *ScopedSymbolIndex::shadowed(Binding const &binding) const {
+    return binding.shadowed == NO_BINDING ? nullptr : &mBindings[binding.shadowed];
+}
+
+ScopedSymbolIndex::Slot &ScopedSymbolIndex::findSlot(utils::SymbolId id) {
+    // Keep the load factor under 1/2
+    if ((mUsedSlots + 1) * 2 > mSlots.size()) {
+        grow();
+    }
+
+    size_t const mask = mSlots.size() - 1;
+    size_t i = hashSymbolId(id, mask);
+    while (mSlots[i].id != id && mSlots[i].id != EMPTY_SLOT) {
+        i = (i + 1) & mask;
+    }
+    if (mSlots[i].id == EMPTY_SLOT) {
+        // Slots are never removed: an unbound name keeps its slot with an empty chain
+        mSlots[i].id = id;
+        mUsedSlots++;
+    }
+    return mSlots[i];
+}
+
+ScopedSymbolIndex::Slot const *ScopedSymbolIndex::findSlot(utils::SymbolId id) const {
+    size_t const mask = mSlots.size() - 1;
+    size_t i = hashSymbolId(id, mask);
+    while (mSlots[i].id != EMPTY_SLOT) {
+        if (mSlots[i].id == id) {
+            return &mSlots[i];
+        }
+        i = (i + 1) & mask;
+    }
+    return nullptr;
+}
+
+void ScopedSymbolIndex::grow() {
+    std::vector<Slot> oldSlots(mSlots.size() * 2, Slot{EMPTY_SLOT, NO_BINDING});
+    oldSlots.swap(mSlots);
+
+    size_t const mask = mSlots.size() - 1;
+    for (Slot const &slot : oldSlots) {
+        if (slot.id != EMPTY_SLOT) {
+            size_t i = hashSymbolId(slot.id, mask);
+            while (mSlots[i].id != EMPTY_SLOT) {
+                i = (i + 1) & mask;
+            }
+            mSlots[i] = slot;
+        }
+    }
+}
+
+} // namespace caramel::ast
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "Symbol.h"
+#include "../../utils/StringInterner.h"
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+
+namespace caramel::ast {
+
+/**
+ * Flat open-addressing hash table shared by every SymbolTable of a translation unit.
+ *
+ * Each slot maps a SymbolId to a chain of bindings, sorted from the innermost scope
+ * to the outermost one. Looking a name up from a scope is one hash probe, followed by
+ * skipping the bindings of the scopes nested deeper than the caller.
+ * Scopes must be closed in stack order, which is what the ContextPusher does.
+ */
+class ScopedSymbolIndex {
+public:
+    using Ptr = std::shared_ptr<ScopedSymbolIndex>;
+
+    struct Binding {
+        Symbol::Ptr symbol;
+        utils::SymbolId id;
+        uint32_t depth;
+        int32_t shadowed;
+    };
+
+    ScopedSymbolIndex();
+
+    /// Binds the symbol in the scope at the given depth, replacing a previous binding of this scope.
+    void bind(utils::SymbolId id, size_t depth, Symbol::Ptr const &symbol);
+
+    /// Removes the binding of the scope at the given depth, if any.
+    void unbind(utils::SymbolId id, size_t depth);
+
+    /// Returns the innermost binding visible from the given depth, or nullptr.
+    Binding const *lookup(utils::SymbolId id, size_t depth) const;
+
+    /// Returns the binding shadowed by the given one, or nullptr.
+    Binding const *shadowed(Binding const &binding) const;
+
+private:
+    struct Slot {
+        utils::SymbolId id;
+        int32_t head;
+    };
+
+    Slot &findSlot(utils::SymbolId id);
+    Slot const *findSlot(utils::SymbolId id) const;
+    void grow();
+
+    std::vector<Slot> mSlots;
+    size_t mUsedSlots;
+    std::vector<Binding> mBindings;
+    std::vector<int32_t> mFreeBindings;
+};
+
+} // namespace caramel::ast
@@ -34,7 +34,8 @@ Symbol::Symbol(
         std::string name,
         PrimaryType::Ptr type,
         SymbolType symbolType
-) : mDeclaration{}, mDefinition{}, mName{std::move(name)}, mType{std::move(type)}, mSymbolType{symbolType} {}
+) : mDeclaration{}, mDefinition{}, mName{std::move(name)}, mId{utils::intern(mName)}, mType{std::move(type)},
+    mSymbolType{symbolType} {}
 
 std::vector<std::weak_ptr<Statement>>
 Symbol::getOccurrences() {
@@ -92,6 +93,10 @@ std::string Symbol::getName() const {
     return mName;
 }
 
+utils::SymbolId Symbol::getId() const {
+    return mId;
+}
+
 void Symbol::acceptAstDotVisit() {
     logger.warning() << "Default accept() for " << thisId() << ", which is a " << mSymbolType << '.';
 }
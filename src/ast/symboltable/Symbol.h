@@ -29,6 +29,7 @@
 #include "../statements/declaration/Declaration.h"
 #include "../statements/expressions/Expression.h"
 #include "../statements/definition/Definition.h"
+#include "../../utils/StringInterner.h"
 
 #include <iostream>
 #include <vector>
@@ -62,6 +63,7 @@ public:
     SymbolType getSymbolType() const;
 
     std::string getName() const;
+    utils::SymbolId getId() const;
 
     void acceptAstDotVisit() override;
 
@@ -83,6 +85,7 @@ protected:
 
 private:
     std::string mName;
+    utils::SymbolId mId;
     PrimaryType::Ptr mType;
     SymbolType mSymbolType;
 };
@@ -44,7 +44,14 @@ namespace caramel::ast {
 using namespace utils;
 using namespace exceptions;
 
-SymbolTable::SymbolTable(SymbolTable::Ptr const &parentTable) : mParentTable(parentTable) {}
+SymbolTable::SymbolTable()
+        : mIndex{std::make_shared<ScopedSymbolIndex>()},
+          mDepth{0} {}
+
+SymbolTable::SymbolTable(SymbolTable::Ptr const &parentTable)
+        : mParentTable(parentTable),
+          mIndex{parentTable->mIndex},
+          mDepth{parentTable->mDepth + 1} {}
 
 VariableSymbol::Ptr SymbolTable::addVariableDeclaration(
         antlr4::ParserRuleContext *antlrContext,
@@ -52,9 +59,10 @@ VariableSymbol::Ptr SymbolTable::addVariableDeclaration(
         std::string const &name,
         const Declaration::Ptr &declaration
 ) {
-    logger.trace() << "SymbolTable::addVariableDeclaration(" << name << ", " << primaryType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addVariableDeclaration(" << name << ", " << primaryType->getIdentifier() << ")";
 
-    if (isDefined(name)) {
+    bool const shadowing = shadowsGlobal(name);
+    if (!shadowing && isDefined(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
         throw SymbolAlreadyDefinedError(
                 name,
@@ -63,7 +71,7 @@ VariableSymbol::Ptr SymbolTable::addVariableDeclaration(
                 symbol->getDefinition(),
                 declaration
         );
-    } else if (isDeclared(name)) {
+    } else if (!shadowing && isDeclared(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
         throw SymbolAlreadyDeclaredError(
                 name,
@@ -73,8 +81,8 @@ VariableSymbol::Ptr SymbolTable::addVariableDeclaration(
                 declaration
         );
     } else {
-        VariableSymbol::Ptr variableSymbol = std::make_shared<VariableSymbol>(name, primaryType);
-        mSymbolMap[name] = variableSymbol;
+        VariableSymbol::Ptr variableSymbol = utils::makeNode<VariableSymbol>(name, primaryType);
+        bindSymbol(name, variableSymbol);
         variableSymbol->addDeclaration(declaration);
         return variableSymbol;
     }
@@ -86,9 +94,10 @@ VariableSymbol::Ptr SymbolTable::addVariableDefinition(
         std::string const &name,
         const Definition::Ptr &definition
 ) {
-    logger.trace() << "SymbolTable::addVariableDefinition(" << name << ", " << primaryType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addVariableDefinition(" << name << ", " << primaryType->getIdentifier() << ")";
 
-    if (isDefined(name)) {
+    bool const shadowing = shadowsGlobal(name);
+    if (!shadowing && isDefined(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
         throw SymbolAlreadyDefinedError(
                 name,
@@ -97,14 +106,14 @@ VariableSymbol::Ptr SymbolTable::addVariableDefinition(
                 symbol->getDefinition(),
                 definition
         );
-    } else if (isDeclared(name)) {
+    } else if (!shadowing && isDeclared(name)) {
         Symbol::Ptr recordedSymbol = getSymbol(antlrContext, name);
         if (recordedSymbol->getSymbolType() != SymbolType::VariableSymbol) {
             throw DeclarationMismatchException(
                     antlrContext,
                     name,
                     SymbolType::VariableSymbol,
-                    mSymbolMap[name]
+                    recordedSymbol
             );
         }
         if (!recordedSymbol->getType()->equals(primaryType)) {
@@ -112,14 +121,14 @@ VariableSymbol::Ptr SymbolTable::addVariableDefinition(
                     antlrContext,
                     name,
                     primaryType,
-                    mSymbolMap[name]
+                    recordedSymbol
             );
         }
         recordedSymbol->addDefinition(definition);
         return std::dynamic_pointer_cast<VariableSymbol>(recordedSymbol);
     } else {
-        VariableSymbol::Ptr variableSymbol = std::make_shared<VariableSymbol>(name, primaryType);
-        mSymbolMap[name] = variableSymbol;
+        VariableSymbol::Ptr variableSymbol = utils::makeNode<VariableSymbol>(name, primaryType);
+        bindSymbol(name, variableSymbol);
         variableSymbol->addDefinition(definition);
         return variableSymbol;
     }
@@ -140,7 +149,7 @@ Symbol::Ptr SymbolTable::addVariableUsage(
                     antlrContext,
                     name,
                     SymbolType::VariableSymbol,
-                    mSymbolMap[name]
+                    symbol
             );
         }
         symbol->addUsage(statement);
@@ -166,9 +175,10 @@ ArraySymbol::Ptr SymbolTable::addArrayDeclaration(
         bool sized, size_t size,
         const Declaration::Ptr &declaration
 ) {
-    logger.trace() << "SymbolTable::addArrayDeclaration(" << name << ", " << primaryType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addArrayDeclaration(" << name << ", " << primaryType->getIdentifier() << ")";
 
-    if (isDefined(name)) {
+    bool const shadowing = shadowsGlobal(name);
+    if (!shadowing && isDefined(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
         throw SymbolAlreadyDefinedError(
                 name,
@@ -177,7 +187,7 @@ ArraySymbol::Ptr SymbolTable::addArrayDeclaration(
                 symbol->getDefinition(),
                 declaration
         );
-    } else if (isDeclared(name)) {
+    } else if (!shadowing && isDeclared(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
         throw SymbolAlreadyDeclaredError(
                 name,
@@ -189,11 +199,11 @@ ArraySymbol::Ptr SymbolTable::addArrayDeclaration(
     } else {
         ArraySymbol::Ptr arraySymbol;
         if (sized) {
-            arraySymbol = std::make_shared<ArraySymbol>(name, primaryType, size);
+            arraySymbol = utils::makeNode<ArraySymbol>(name, primaryType, size);
         } else {
-            arraySymbol = std::make_shared<ArraySymbol>(name, primaryType);
+            arraySymbol = utils::makeNode<ArraySymbol>(name, primaryType);
         }
-        mSymbolMap[name] = arraySymbol;
+        bindSymbol(name, arraySymbol);
         arraySymbol->addDeclaration(declaration);
         return arraySymbol;
     }
@@ -206,9 +216,10 @@ ArraySymbol::Ptr SymbolTable::addArrayDefinition(
         std::vector<Expression::Ptr> &&content,
         const Definition::Ptr &definition
 ) {
-    logger.trace() << "SymbolTable::addArrayDefinition(" << name << ", " << primaryType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addArrayDefinition(" << name << ", " << primaryType->getIdentifier() << ")";
 
-    if (isDefined(name)) {
+    bool const shadowing = shadowsGlobal(name);
+    if (!shadowing && isDefined(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
         throw SymbolAlreadyDefinedError(
                 name,
@@ -217,14 +228,14 @@ ArraySymbol::Ptr SymbolTable::addArrayDefinition(
                 symbol->getDefinition(),
                 definition
         );
-    } else if (isDeclared(name)) {
+    } else if (!shadowing && isDeclared(name)) {
         Symbol::Ptr recordedSymbol = getSymbol(antlrContext, name);
         if (recordedSymbol->getSymbolType() != SymbolType::ArraySymbol) {
             throw DeclarationMismatchException(
                     antlrContext,
                     name,
                     SymbolType::ArraySymbol,
-                    mSymbolMap[name]
+                    recordedSymbol
             );
         }
         if (!recordedSymbol->getType()->equals(primaryType)) {
@@ -232,14 +243,14 @@ ArraySymbol::Ptr SymbolTable::addArrayDefinition(
                     antlrContext,
                     name,
                     primaryType,
-                    mSymbolMap[name]
+                    recordedSymbol
             );
         }
         recordedSymbol->addDefinition(definition);
         return castTo<ArraySymbol::Ptr>(recordedSymbol);
     } else {
-        ArraySymbol::Ptr arraySymbol = std::make_shared<ArraySymbol>(name, primaryType, std::move(content));
-        mSymbolMap[name] = arraySymbol;
+        ArraySymbol::Ptr arraySymbol = utils::makeNode<ArraySymbol>(name, primaryType, std::move(content));
+        bindSymbol(name, arraySymbol);
         arraySymbol->addDefinition(definition);
         return arraySymbol;
     }
@@ -259,7 +270,7 @@ ArraySymbol::Ptr SymbolTable::addArrayAccess(
                     antlrContext,
                     name,
                     SymbolType::ArraySymbol,
-                    mSymbolMap[name]
+                    symbol
             );
         }
         auto const &arraySymbol = castTo<ArraySymbol::Ptr>(symbol);
@@ -287,7 +298,7 @@ FunctionSymbol::Ptr SymbolTable::addFunctionDeclaration(
         const Declaration::Ptr &declaration,
         bool variadic
 ) {
-    logger.trace() << "SymbolTable::addFunctionDeclaration(" << name << ", " << returnType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addFunctionDeclaration(" << name << ", " << returnType->getIdentifier() << ")";
 
     if (isDeclared(name)) { // or defined
 
@@ -343,8 +354,8 @@ FunctionSymbol::Ptr SymbolTable::addFunctionDeclaration(
         functionSymbol->addDeclaration(declaration);
         return functionSymbol;
     } else {
-        FunctionSymbol::Ptr functionSymbol = std::make_shared<FunctionSymbol>(name, returnType, variadic);
-        mSymbolMap[name] = functionSymbol;
+        FunctionSymbol::Ptr functionSymbol = utils::makeNode<FunctionSymbol>(name, returnType, variadic);
+        bindSymbol(name, functionSymbol);
         functionSymbol->setParameters(std::move(parameters));
         functionSymbol->addDeclaration(declaration);
         return functionSymbol;
@@ -360,7 +371,7 @@ FunctionSymbol::Ptr SymbolTable::addFunctionDefinition(
         const Definition::Ptr &definition,
         bool variadic
 ) {
-    logger.trace() << "SymbolTable::addFunctionDefinition(" << name << ", " << returnType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addFunctionDefinition(" << name << ", " << returnType->getIdentifier() << ")";
 
     if (isDefined(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
@@ -430,8 +441,8 @@ FunctionSymbol::Ptr SymbolTable::addFunctionDefinition(
         functionSymbol->addDefinition(definition);
         return functionSymbol;
     } else {
-        FunctionSymbol::Ptr functionSymbol = std::make_shared<FunctionSymbol>(name, returnType, variadic);
-        mSymbolMap[name] = functionSymbol;
+        FunctionSymbol::Ptr functionSymbol = utils::makeNode<FunctionSymbol>(name, returnType, variadic);
+        bindSymbol(name, functionSymbol);
         functionSymbol->setContext(functionContext);
         functionSymbol->setParameters(std::move(parameters));
         functionSymbol->addDefinition(definition);
@@ -445,7 +456,7 @@ Symbol::Ptr SymbolTable::addFunctionParameter(
         PrimaryType::Ptr const &primaryType,
         SymbolType parameterType
 ) {
-    logger.trace() << "SymbolTable::addFunctionParameter(" << name << ", " << primaryType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addFunctionParameter(" << name << ", " << primaryType->getIdentifier() << ")";
 
     if (isDefined(name)) {
         auto const &symbol = getSymbol(antlrContext, name);
@@ -453,12 +464,12 @@ Symbol::Ptr SymbolTable::addFunctionParameter(
         throw std::runtime_error("Two different parameters can't have the same name.");
     } else { // If it's defined, we just shadow it
         if (parameterType == SymbolType::ArraySymbol) {
-            ArraySymbol::Ptr arraySymbol = std::make_shared<ArraySymbol>(name, primaryType);
-            mSymbolMap[name] = arraySymbol;
+            ArraySymbol::Ptr arraySymbol = utils::makeNode<ArraySymbol>(name, primaryType);
+            bindSymbol(name, arraySymbol);
             return castTo<Symbol::Ptr>(arraySymbol);
         } else if (parameterType == SymbolType::VariableSymbol) {
-            VariableSymbol::Ptr variableSymbol = std::make_shared<VariableSymbol>(name, primaryType);
-            mSymbolMap[name] = variableSymbol;
+            VariableSymbol::Ptr variableSymbol = utils::makeNode<VariableSymbol>(name, primaryType);
+            bindSymbol(name, variableSymbol);
             return castTo<Symbol::Ptr>(variableSymbol);
         } else {
             throw std::runtime_error("This can't be. And it is. Have a cookie!");
@@ -480,7 +491,7 @@ FunctionSymbol::Ptr SymbolTable::addFunctionCall(
                     antlrContext,
                     name,
                     SymbolType::FunctionSymbol,
-                    mSymbolMap[name]
+                    symbol
             );
         }
         auto functionSymbol = castTo<FunctionSymbol::Ptr>(symbol);
@@ -522,13 +533,14 @@ void SymbolTable::addPrimaryType(
         PrimaryType::Ptr const &primaryType,
         std::string const &name
 ) {
-    logger.trace() << "SymbolTable::addPrimaryType(" << name << ", " << primaryType->getIdentifier() << ")";
+    CARAMEL_TRACE << "SymbolTable::addPrimaryType(" << name << ", " << primaryType->getIdentifier() << ")";
 
     // Not declared and not defined
     if (isNotDeclared(name) && isNotDefined(name)) {
-        mSymbolMap[name] = std::make_shared<TypeSymbol>(name, primaryType);
-        mSymbolMap.at(name)->addDeclaration(nullptr);
-        mSymbolMap.at(name)->addDefinition(nullptr);
+        TypeSymbol::Ptr typeSymbol = utils::makeNode<TypeSymbol>(name, primaryType);
+        bindSymbol(name, typeSymbol);
+        typeSymbol->addDeclaration(nullptr);
+        typeSymbol->addDefinition(nullptr);
     } else {
         logger.fatal() << "Can't add " << name << " as a primary type, because a symbol named " << name
                        << " already exists.";
@@ -541,7 +553,7 @@ TypeSymbol::Ptr SymbolTable::addType(
         TypeDefinition::Ptr definition
 ) {
     auto definitionSymbol = definition->getSymbol().lock();
-    logger.trace() << "SymbolTable::addType(" << definitionSymbol->getName() << ", "
+    CARAMEL_TRACE << "SymbolTable::addType(" << definitionSymbol->getName() << ", "
                    << definitionSymbol->getType()->getIdentifier() << ")";
 
     std::string typeAlias = definitionSymbol->getName();
@@ -549,45 +561,51 @@ TypeSymbol::Ptr SymbolTable::addType(
 
     // Not declared and not defined
     if (isNotDeclared(typeAlias)) {
-        TypeSymbol::Ptr typeSymbol = std::make_shared<TypeSymbol>(typeAlias, primaryType);
-        mSymbolMap[typeAlias] = typeSymbol;
+        TypeSymbol::Ptr typeSymbol = utils::makeNode<TypeSymbol>(typeAlias, primaryType);
+        bindSymbol(typeAlias, typeSymbol);
         typeSymbol->addDefinition(definition);
         return typeSymbol;
     } else {
+        auto const &symbol = getSymbol(antlrContext, typeAlias);
         throw caramel::exceptions::SymbolAlreadyDeclaredError(
                 "Cannot execute typedef",
-                mSymbolMap[typeAlias],
+                symbol,
                 antlrContext,
-                mSymbolMap[typeAlias]->getDeclaration(),
+                symbol->getDeclaration(),
                 std::dynamic_pointer_cast<Declaration>(definition));
     }
 }
 
+void SymbolTable::exitScope() {
+    logger.trace() << "SymbolTable::exitScope(): depth " << mDepth << ", " << mSymbols.size() << " symbols";
+
+    for (auto const &[id, symbol] : mSymbols) {
+        mIndex->unbind(id, mDepth);
+    }
+}
+
 bool SymbolTable::hasSymbol(std::string const &name) {
-    return thisHasSymbol(name) || parentHasSymbol(name);
+    return lookup(name, mDepth) != nullptr;
 }
 
 bool SymbolTable::thisHasSymbol(std::string const &name) {
-    return mSymbolMap.find(name) != mSymbolMap.end();
+    auto const *binding = lookup(name, mDepth);
+    return binding && binding->depth == mDepth;
 }
 
 bool SymbolTable::parentHasSymbol(std::string const &name) {
-    return getParentTable() && getParentTable()->hasSymbol(name);
+    return mDepth > 0 && lookup(name, mDepth - 1) != nullptr;
 }
 
 Symbol::Ptr
 SymbolTable::getSymbol(antlr4::ParserRuleContext *antlrContext, std::string const &name) {
     logger.trace() << "SymbolTable::getSymbol(): " << grey << name;
 
-    if (thisHasSymbol(name)) {
-        return mSymbolMap.at(name);
+    auto const *binding = lookup(name, mDepth);
+    if (binding) {
+        return binding->symbol;
     } else {
-        SymbolTable::Ptr parent = getParentTable();
-        if (parent) {
-            return parent->getSymbol(antlrContext, name);
-        } else {
-            throw UndefinedSymbolError(name, antlrContext);
-        }
+        throw UndefinedSymbolError(name, antlrContext);
     }
 }
 
@@ -596,33 +614,72 @@ SymbolTable::Ptr SymbolTable::getParentTable() {
 }
 
 size_t SymbolTable::getNumberOfSymbols() const {
-    return mSymbolMap.size();
+    return mSymbols.size();
 }
 
-std::map<std::string, Symbol::Ptr> const &SymbolTable::getSymbols() const {
-    return mSymbolMap;
+std::vector<std::pair<utils::SymbolId, Symbol::Ptr>> const &SymbolTable::getSymbols() const {
+    return mSymbols;
 }
 
 void SymbolTable::acceptAstDotVisit() {
-    addNode(thisId(), "SymbolTable: " + std::to_string(mSymbolMap.size()) + " symbols", "cylinder", "darkorange");
+    addNode(thisId(), "SymbolTable: " + std::to_string(mSymbols.size()) + " symbols", "cylinder", "darkorange");
     visitChildrenAstDot();
 }
 
 void SymbolTable::visitChildrenAstDot() {
-    for (auto const &symbol : mSymbolMap) {
-        addEdge(thisId(), symbol.second->thisId(), symbol.first);
-        symbol.second->acceptAstDotVisit();
+    for (auto const &[id, symbol] : mSymbols) {
+        addEdge(thisId(), symbol->thisId(), utils::internedString(id));
+        symbol->acceptAstDotVisit();
     }
 }
 
 bool SymbolTable::isDeclared(const std::string &name) {
-    return (thisHasSymbol(name) && mSymbolMap.at(name)->isDeclared()) ||
-           (getParentTable() && getParentTable()->isDeclared(name));
+    for (auto const *binding = lookup(name, mDepth);
+         binding; binding = mIndex->shadowed(*binding)) {
+        if (binding->symbol->isDeclared()) {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool SymbolTable::isDefined(const std::string &name) {
-    return (thisHasSymbol(name) && mSymbolMap.at(name)->isDefined()) ||
-           (getParentTable() && getParentTable()->isDefined(name));
+    for (auto const *binding = lookup(name, mDepth);
+         binding; binding = mIndex->shadowed(*binding)) {
+        if (binding->symbol->isDefined()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SymbolTable::shadowsGlobal(std::string const &name) {
+    // The back-end can tell a local from a global, but not two locals of the same function
+    auto const *binding = lookup(name, mDepth);
+    return mDepth > 0 && binding && binding->depth == 0;
+}
+
+ScopedSymbolIndex::Binding const *SymbolTable::lookup(std::string const &name, size_t depth) const {
+    // The queries don't intern the names, a name that was never interned has no binding
+    auto const id = utils::findInterned(name);
+    return id ? mIndex->lookup(*id, depth) : nullptr;
+}
+
+void SymbolTable::bindSymbol(std::string const &name, Symbol::Ptr const &symbol) {
+    utils::SymbolId const id = utils::intern(name);
+
+    auto const *binding = mIndex->lookup(id, mDepth);
+    if (binding && binding->depth == mDepth) {
+        // Rebinding a name of this scope, e.g. a parameter redeclared in the function body
+        for (auto &[boundId, boundSymbol] : mSymbols) {
+            if (boundId == id) {
+                boundSymbol = symbol;
+            }
+        }
+    } else {
+        mSymbols.emplace_back(id, symbol);
+    }
+    mIndex->bind(id, mDepth, symbol);
 }
 
 } // namespace caramel::ast
@@ -26,6 +26,7 @@
 
 #include "Common.h"
 #include "Symbol.h"
+#include "ScopedSymbolIndex.h"
 #include "TypeSymbol.h"
 #include "ArraySymbol.h"
 #include "VariableSymbol.h"
@@ -36,7 +37,7 @@
 
 #include <CaramelBaseVisitor.h>
 
-#include <map>
+#include <vector>
 #include <string>
 #include <memory>
 
@@ -50,7 +51,7 @@ public:
     using Ptr = std::shared_ptr<SymbolTable>;
     using WeakPtr = std::weak_ptr<SymbolTable>;
 
-    SymbolTable() = default;
+    SymbolTable();
     explicit SymbolTable(SymbolTable::Ptr const &parentTable);
 
     //------------------------------------------------------------------------------------------------------------------
@@ -149,6 +150,9 @@ public:
     //------------------------------------------------------------------------------------------------------------------
     // Misc.
 
+    /// Unbinds the symbols of this table. The enclosed scopes must have been exited before.
+    void exitScope();
+
     bool hasSymbol(std::string const &name);
     bool thisHasSymbol(std::string const &name);
     bool parentHasSymbol(std::string const &name);
@@ -156,7 +160,7 @@ public:
     std::shared_ptr<SymbolTable> getParentTable();
 
     size_t getNumberOfSymbols() const;
-    std::map<std::string, Symbol::Ptr> const &getSymbols() const;
+    std::vector<std::pair<utils::SymbolId, Symbol::Ptr>> const &getSymbols() const;
 
     void acceptAstDotVisit() override;
     void visitChildrenAstDot() override;
@@ -167,8 +171,15 @@ public:
     inline bool isNotDefined(std::string const &name) { return !isDefined(name); }
 
 private:
-    std::map<std::string, Symbol::Ptr> mSymbolMap;
+    /// A local definition shadows a global one, but not a local one of an enclosing block.
+    bool shadowsGlobal(std::string const &name);
+    ScopedSymbolIndex::Binding const *lookup(std::string const &name, size_t depth) const;
+    void bindSymbol(std::string const &name, Symbol::Ptr const &symbol);
+
+    std::vector<std::pair<utils::SymbolId, Symbol::Ptr>> mSymbols;
     std::shared_ptr<SymbolTable> mParentTable;
+    ScopedSymbolIndex::Ptr mIndex;
+    size_t mDepth;
 };
 
 } // namespace caramel::dataStructure::symbolTable
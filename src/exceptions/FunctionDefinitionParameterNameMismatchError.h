@@ -42,14 +42,12 @@ public:
                                                  std::string declaredName,
                                                  std::string definedName);
 
-    void explain(utils::SourceFileUtil sourceFileUtil) const override;
+    void explain(utils::SourceFileUtil const &sourceFileUtil, std::ostream &out) const override;
 
 protected:
     std::string buildFunctionDefinitionParameterNameMismatchErrorMessage(const std::string &name,
                                                                          std::string declaredName,
                                                                          std::string definedName);
-private:
-    antlr4::ParserRuleContext *mAntlrContext;
 };
 
 } // namespace caramel::exceptions
@@ -39,7 +39,7 @@ FunctionDefinitionParameterTypeMismatchError::FunctionDefinitionParameterTypeMis
                         antlrContext) {
 }
 
-void FunctionDefinitionParameterTypeMismatchError::note() const {
+void FunctionDefinitionParameterTypeMismatchError::note(std::ostream &) const {
 }
 
 std::string FunctionDefinitionParameterTypeMismatchError::buildFunctionDefinitionParameterTypeMismatchErrorMessage(
@@ -47,7 +47,7 @@ public:
                                                  std::shared_ptr<PrimaryType> declaredType,
                                                  std::shared_ptr<PrimaryType> definedType);
 
-    void note() const override;
+    void note(std::ostream &out) const override;
 
 protected:
     std::string buildFunctionDefinitionParameterTypeMismatchErrorMessage(
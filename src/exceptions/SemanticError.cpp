@@ -24,7 +24,7 @@
 
 #include "SemanticError.h"
 
-#include <Token.h>
+#include <algorithm>
 
 
 namespace caramel::exceptions {
@@ -36,29 +36,33 @@ using namespace colors;
 
 SemanticError::SemanticError(std::string const &message, antlr4::ParserRuleContext *antlrContext)
         : std::runtime_error(message),
-          mAntlrContext{antlrContext}{}
+          mLocation{antlrContext} {}
 
-void SemanticError::explain(utils::SourceFileUtil sourceFileUtil) const {
-    // TODO: Create helper functions
+void SemanticError::explain(utils::SourceFileUtil const &sourceFileUtil, std::ostream &out) const {
+    explainContext(sourceFileUtil, out, mLocation, "semantic error at ", what());
+
+    // Add notes
+    note(out);
+}
+
+utils::SourceLocation const &SemanticError::getLocation() const {
+    return mLocation;
+}
+
+void SemanticError::explainContext(
+        utils::SourceFileUtil const &sourceFileUtil,
+        std::ostream &out,
+        utils::SourceLocation const &location,
+        std::string_view title,
+        std::string_view message
+) {
     const int LEFT_MARGIN = 4;
 
     // Get shorter names for these
-    auto const &start = mAntlrContext->getStart();
-    auto const startLine = start->getLine();
-    auto const startColumn = int(start->getCharPositionInLine());
-    auto const &stop = mAntlrContext->getStop();
-    auto const length = int(mAntlrContext->getText().length());
-
-    // TODO: Handle multi-line statements
-    if (start->getLine() != stop->getLine()) {
-        logger.warning() << "Errors are buggy for multi-line statements.";
-    }
-
-    // Strip the left and right spaces
-    std::string line(sourceFileUtil.getLine(startLine));
-    size_t begin = line.find_first_not_of(' ');
-    size_t end = line.find_last_not_of(' ') + 1;
-    line = line.substr(begin, end - begin);
+    auto const startLine = location.line;
+    auto const stopLine = location.stopLine;
+    auto const startColumn = location.column;
+    auto const stopColumn = location.stopColumn;
 
     std::stringstream posInfoSS;
     posInfoSS << startLine << ':' << startColumn;
@@ -66,16 +70,36 @@ void SemanticError::explain(utils::SourceFileUtil sourceFileUtil) const {
     auto posInfoLength = int(posInfo.length());
 
     // Print the error
-    std::cerr << red << bold << "semantic error at " << posInfo << ": " << reset
-              << what() << std::endl
-              << posInfo << std::setfill(' ') << std::setw(LEFT_MARGIN) << ""
-              << line << std::endl
-              << std::setfill(' ') << std::setw(LEFT_MARGIN + posInfoLength + startColumn - int(begin)) << ""
-              << bold << red << std::setfill('~') << std::setw(length) << "" << reset
-              << std::endl;
-
-    // Add notes
-    note();
+    out << red << bold << title << posInfo << ": " << reset
+              << message << std::endl;
+
+    for (size_t lineNumber = startLine; lineNumber <= stopLine; ++lineNumber) {
+        // Strip the left and right spaces
+        std::string_view line = sourceFileUtil.getLine(lineNumber);
+        size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string_view::npos) {
+            continue;
+        }
+        size_t end = line.find_last_not_of(" \t\r") + 1;
+
+        // The span goes on from the first line to the last one
+        size_t from = lineNumber == startLine ? std::max(startColumn, begin) : begin;
+        size_t to = lineNumber == stopLine ? std::min(stopColumn, end) : end;
+        if (to <= from) {
+            to = from + 1;
+        }
+
+        if (lineNumber == startLine) {
+            out << posInfo;
+        } else {
+            out << std::setfill(' ') << std::setw(posInfoLength) << "";
+        }
+        out << std::setfill(' ') << std::setw(LEFT_MARGIN) << ""
+                  << line.substr(begin, end - begin) << std::endl
+                  << std::setfill(' ') << std::setw(LEFT_MARGIN + posInfoLength + int(from - begin)) << ""
+                  << bold << red << std::setfill('~') << std::setw(int(to - from)) << "" << reset
+                  << std::endl;
+    }
 }
 
 } // namespace caramel::exceptions
@@ -25,12 +25,15 @@
 #pragma once
 
 #include "../utils/SourceFileUtil.h"
+#include "../utils/SourceLocation.h"
 #include "../Console.h"
 #include "../Logger.h"
 
 #include <ParserRuleContext.h>
 
+#include <ostream>
 #include <stdexcept>
+#include <string_view>
 
 
 namespace caramel::exceptions {
@@ -39,13 +42,23 @@ class SemanticError : public std::runtime_error {
 public:
     SemanticError(std::string const &message, antlr4::ParserRuleContext *antlrContext);
 
-    virtual void explain(utils::SourceFileUtil sourceFileUtil) const;
+    virtual void explain(utils::SourceFileUtil const &sourceFileUtil, std::ostream &out) const;
+
+    utils::SourceLocation const &getLocation() const;
 
 protected:
-    virtual void note() const {}
+    virtual void note(std::ostream &) const {}
+
+    /// Prints the title and the message, then every source line of the location with its span underlined.
+    static void explainContext(utils::SourceFileUtil const &sourceFileUtil,
+                               std::ostream &out,
+                               utils::SourceLocation const &location,
+                               std::string_view title,
+                               std::string_view message);
 
 private:
-    antlr4::ParserRuleContext *mAntlrContext;
+    // Copied at the throw, the syntax tree may be gone when the error is explained
+    utils::SourceLocation mLocation;
 };
 
 } // namespace caramel::exceptions
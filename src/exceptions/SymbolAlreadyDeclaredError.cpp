@@ -41,10 +41,10 @@ SymbolAlreadyDeclaredError::SymbolAlreadyDeclaredError(std::string const &messag
           mFaultyDeclaration{faultyDeclaration},
           mSymbol{symbol}{}
 
-void SymbolAlreadyDeclaredError::note() const {
+void SymbolAlreadyDeclaredError::note(std::ostream &out) const {
     if (1) {
         //TODO: test if different type, return primary type (int32_t) instead of statement type (VariableDeclaration)
-        std::cerr << bold << "Note: " << reset
+        out << bold << "Note: " << reset
                   << "different previous type: was " <<  mSymbol->getType()->getIdentifier()
                   << " and is now " << mFaultyDeclaration->getType()
                   << std::endl;
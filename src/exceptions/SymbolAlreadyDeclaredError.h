@@ -46,7 +46,7 @@ public:
                                std::shared_ptr<ast::Declaration> const &existingDeclaration,
                                std::shared_ptr<ast::Declaration> const &faultyDeclaration);
 
-    void note() const override;
+    void note(std::ostream &out) const override;
 
     std::string
     buildAlreadyDeclaredErrorMessage(std::string const &variableName, std::shared_ptr<ast::Symbol> symbol);
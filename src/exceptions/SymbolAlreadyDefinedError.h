@@ -47,7 +47,7 @@ public:
                               std::shared_ptr<ast::Declaration> const &faultyDeclaration);
 
 protected:
-    void note() const override;
+    void note(std::ostream &out) const override;
 
     std::string
     buildAlreadyDefinedErrorMessage(std::string const &variableName, std::shared_ptr<ast::Symbol> symbol);
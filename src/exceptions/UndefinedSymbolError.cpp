@@ -40,7 +40,7 @@ UndefinedSymbolError::UndefinedSymbolError(std::string const &message,
                                            antlr4::ParserRuleContext *antlrContext)
         : SemanticError(buildUnknownSymbolErrorMessage(message), antlrContext) {}
 
-void UndefinedSymbolError::note() const {}
+void UndefinedSymbolError::note(std::ostream &) const {}
 
 std::string UndefinedSymbolError::buildUndefinedSymbolErrorMessage(std::string const &name, SymbolType const &symbolType) {
     std::stringstream res;
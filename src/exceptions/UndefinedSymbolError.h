@@ -47,7 +47,7 @@ public:
     UndefinedSymbolError(std::string const &message,
                          antlr4::ParserRuleContext *antlrContext);
 
-    void note() const override;
+    void note(std::ostream &out) const override;
 
     std::string buildUndefinedSymbolErrorMessage(std::string const &name, ast::SymbolType const &symbolType);
     std::string buildUnknownSymbolErrorMessage(std::string const &name);
@@ -30,9 +30,11 @@ BasicBlock::BasicBlock(
         size_t id,
         size_t functionContext,
         CFG *cfg,
-        std::string entryName
+        std::string entryName,
+        std::shared_ptr<FunctionFrame> frame
 ) : mID{id},
     mFunctionContext{functionContext},
+    mFrame{std::move(frame)},
     mExitWhenTrue{},
     mExitWhenFalse{},
     mCfg{cfg},
@@ -55,6 +57,14 @@ void BasicBlock::setExitWhenFalse(const std::shared_ptr<BasicBlock> &ExitWhenFal
     mExitWhenFalse = ExitWhenFalse;
 }
 
+void BasicBlock::addJumpTarget(const std::shared_ptr<BasicBlock> &jumpTarget) {
+    mJumpTargets.push_back(jumpTarget);
+}
+
+std::vector<std::shared_ptr<BasicBlock>> const &BasicBlock::getJumpTargets() const {
+    return mJumpTargets;
+}
+
 std::string BasicBlock::addInstruction(std::shared_ptr<IR> const &instruction) {
     mInstructions.push_back(instruction);
 
@@ -82,12 +92,19 @@ size_t BasicBlock::getFunctionContext() const {
     return mFunctionContext;
 }
 
+std::shared_ptr<FunctionFrame> const &BasicBlock::getFrame() const {
+    return mFrame;
+}
+
 std::vector<std::shared_ptr<IR>> &BasicBlock::getInstructions() {
     return mInstructions;
 }
 
 std::string BasicBlock::getLabelName() {
-    return mLabelName; // + "_" + std::to_string(getId()) + " " + std::to_string(getFunctionContext());
+    if (mLabel) {
+        return mFrame->getNaming().getLabelName(*mLabel) + mLabelName;
+    }
+    return mLabelName;
 }
 
 bool BasicBlock::hasSymbol(std::string const &symbolName) const {
@@ -98,6 +115,10 @@ bool BasicBlock::isSymbolParamArray(std::string const &symbolName) {
     return mCfg->isSymbolParamArray(mFunctionContext, symbolName);
 }
 
+bool BasicBlock::isSymbolGlobal(std::string const &symbolName) {
+    return mCfg->isSymbolGlobal(mFunctionContext, symbolName);
+}
+
 long BasicBlock::addParamArraySymbol(std::string const &symbolName, ast::PrimaryType::Ptr type) {
     return mCfg->addParamArraySymbol(mFunctionContext, symbolName, type);
 }
@@ -118,12 +139,8 @@ long BasicBlock::getSymbolIndex(std::string const &symbolName) {
     return mCfg->getSymbolIndex(mFunctionContext, symbolName);
 }
 
-std::string BasicBlock::getNextNumberName() {
-    return ".L" + std::to_string(mNextNumberName++);
-}
-
 BasicBlock::Ptr BasicBlock::getNewWhenTrueBasicBlock(std::string nameSuffix) {
-    auto child = mCfg->generateBasicBlock(getNextNumberName() + nameSuffix);
+    auto child = mCfg->generateLabeledBasicBlock(nameSuffix);
     if (this->getNextWhenTrue()) child->setExitWhenTrue(this->getNextWhenTrue());
     if (this->getNextWhenFalse()) child->setExitWhenFalse(this->getNextWhenFalse());
     this->setExitWhenTrue(child);
@@ -134,10 +151,21 @@ void BasicBlock::addInstructions(std::shared_ptr<BasicBlock> const &child) {
     std::move(child->mInstructions.begin(), child->mInstructions.end(), std::back_inserter(mInstructions));
 }
 
-long BasicBlock::mNextNumberName = 0;
+void BasicBlock::unlink() {
+    mExitWhenTrue.reset();
+    mExitWhenFalse.reset();
+    mJumpTargets.clear();
+    mInstructions.clear();
+}
 
 void BasicBlock::setLabelName(const std::string &name) {
+    mLabel.reset();
     mLabelName = name;
 }
 
+void BasicBlock::setLabel(uint32_t label, std::string suffix) {
+    mLabel = label;
+    mLabelName = std::move(suffix);
+}
+
 } // namespace caramel::ir
\ No newline at end of file
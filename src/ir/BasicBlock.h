@@ -26,9 +26,11 @@
 
 #include "IR.h"
 #include "CFG.h"
+#include "FunctionFrame.h"
 #include "../ast/symboltable/Symbol.h"
 #include <ostream>
 #include <vector>
+#include <optional>
 
 namespace caramel::ir {
 
@@ -41,7 +43,8 @@ public:
             size_t id,
             size_t functionContext,
             CFG *cfg,
-            std::string entryName
+            std::string entryName,
+            std::shared_ptr<FunctionFrame> frame
     );
 
     virtual ~BasicBlock() = default;
@@ -58,6 +61,7 @@ public:
 
     bool hasSymbol(std::string const &symbolName) const;
     bool isSymbolParamArray(std::string const &symbolName);
+    bool isSymbolGlobal(std::string const &symbolName);
     long addParamArraySymbol(std::string const &symbolName, ast::PrimaryType::Ptr type);
     long addArraySymbol(std::string const &symbolName, ast::PrimaryType::Ptr type, size_t length);
     long addSymbol(std::string const &symbolName, ast::PrimaryType::Ptr type);
@@ -67,25 +71,42 @@ public:
     void setExitWhenTrue(const std::shared_ptr<BasicBlock> &ExitWhenTrue);
     void setExitWhenFalse(const std::shared_ptr<BasicBlock> &ExitWhenFalse);
 
+    void addJumpTarget(const std::shared_ptr<BasicBlock> &jumpTarget);
+    std::vector<std::shared_ptr<BasicBlock>> const & getJumpTargets() const;
+
     CFG * getCFG();
 
     void setLabelName(std::string const &name);
 
+    /**
+     * Names this basic block with a label of its function, rendered by getLabelName() as the label and the suffix.
+     */
+    void setLabel(uint32_t label, std::string suffix = "");
+
     size_t getId() const;
 
     size_t getFunctionContext() const;
+    std::shared_ptr<FunctionFrame> const &getFrame() const;
 
-    static std::string getNextNumberName();
     BasicBlock::Ptr getNewWhenTrueBasicBlock(std::string nameSuffix = "");
 
     void addInstructions(std::shared_ptr<BasicBlock> const &child);
 
+    /**
+     * Drops the exits and the instructions, so that the basic blocks of a loop can be destroyed.
+     */
+    void unlink();
+
 public:
     bool mIsControlBlock = false; // FIXME: suicide me
 
 private:
     size_t mID;
     size_t mFunctionContext;
+    /**
+     * frame of the function, created with its root basic block and shared by all its basic blocks
+     */
+    std::shared_ptr<FunctionFrame> mFrame;
     /**
      * pointer to the next basic block, true branch. If nullptr, return from procedure
      */
@@ -95,11 +116,16 @@ private:
      * pointer to the next basic block, false branch. If nullptr, the basic block ends with an unconditional jump
      */
     std::shared_ptr<BasicBlock> mExitWhenFalse;
+
+    /**
+     * other basic blocks reachable through an indirect jump, such as a jump table
+     */
+    std::vector<std::shared_ptr<BasicBlock>> mJumpTargets;
     CFG *mCfg;
     std::vector<std::shared_ptr<IR>> mInstructions;
     std::map<std::string, int> mSymbolsIndex;
 
-    static long mNextNumberName; // For labels
+    std::optional<uint32_t> mLabel;
     std::string mLabelName;
 };
 
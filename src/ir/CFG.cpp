@@ -26,74 +26,202 @@
 #include "BasicBlock.h"
 #include "../Console.h"
 #include "../utils/Common.h"
+#include "../utils/Arena.h"
+#include "../utils/Parallel.h"
+#include "../ast/statements/declaration/VariableDeclaration.h"
+#include "../ast/statements/declaration/ArrayDeclaration.h"
+#include "../ast/statements/definition/VariableDefinition.h"
+#include "../ast/statements/definition/ArrayDefinition.h"
+#include "../ast/symboltable/VariableSymbol.h"
+#include "../ast/symboltable/ArraySymbol.h"
+
+#include <optional>
 
 namespace caramel::ir {
 
 using namespace colors;
 using namespace caramel::utils;
 
+/**
+ * Splits an array element name, like "array[3]", into its array name and index.
+ */
+static std::optional<std::pair<std::string, long>> splitArrayElement(std::string const &symbolName) {
+    if (symbolName.empty() || symbolName.back() != ']') {
+        return {};
+    }
+    auto const bracket = symbolName.find('[');
+    if (bracket == std::string::npos) {
+        return {};
+    }
+    return std::make_pair(symbolName.substr(0, bracket), std::stol(symbolName.substr(bracket + 1)));
+}
+
 CFG::CFG(
         std::string const &fileName,
-        ast::Context::Ptr treeContext
+        ast::Context::Ptr treeContext,
+        Config const &config
 ) : mFileName{fileName},
     mRootContext{std::move(treeContext)},
-    mSymbols{},
-    mSymbolIndex{},
-    mNextBasicBlockNumber{0},
-    mNextFunctionContext{0},
+    mConfig{config},
+    mFrames{utils::makeNode<FunctionFrame>(0)},
     mFunctionsBasicBlocks{},
-    mGlobalContext{} {
+    mGlobalVariables{} {
     logger.debug() << "New CFG for " << mFileName << ".";
 
+    // The globals go first into the frame 0, which is only read while lowering the functions
+    std::vector<ast::Statement::Ptr> functions;
     for (ast::Statement::Ptr const &statement : mRootContext->getStatements()) {
         if (statement->getType() == ast::StatementType::FunctionDefinition) {
+            functions.push_back(statement);
+        } else {
+            addGlobalVariable(statement);
+        }
+    }
 
-            auto[function_begin, function_end] = statement->getBasicBlock(this);
-            mFunctionsBasicBlocks.push_back(function_begin);
-            CARAMEL_UNUSED(function_end);
+    // The function contexts are given in source order, so the output doesn't depend on the scheduling
+    for (size_t i = 0; i < functions.size(); ++i) {
+        mFrames.push_back(utils::makeNode<FunctionFrame>(i + 1));
+    }
 
-        } else {
-            logger.warning() << "Skipping not-yet-handled non function definition statement in CFG::CFG().";
+    // Each function only writes to its own frame and basic blocks, so they are lowered concurrently
+    mFunctionsBasicBlocks.resize(functions.size());
+    utils::Arena *const arena = utils::Arena::current();
+    utils::parallelFor(functions.size(), mConfig.jobs, [&](size_t i) {
+        // Each task allocates its nodes in its own arena
+        utils::ArenaScope arenaScope{arena ? &arena->createChild() : nullptr};
+        LoweringScope loweringScope{*mFrames[i + 1]};
+        auto[function_begin, function_end] = functions[i]->getBasicBlock(this);
+        mFunctionsBasicBlocks[i] = function_begin;
+        CARAMEL_UNUSED(function_end);
+    });
+}
+
+CFG::~CFG() {
+    // Without this, the basic blocks of the loops and their instructions keep each other alive
+    for (auto const &frame : mFrames) {
+        frame->releaseBasicBlocks();
+    }
+}
 
-            if (statement->shouldReturnAnIR()) {
-                mGlobalContext.push_back(castTo<caramel::ast::Declaration::Ptr>(statement));
+void CFG::addGlobalVariable(ast::Statement::Ptr const &statement) {
+    // Globals live in the context 0, which is looked up after the function's one
+    GlobalVariable global;
+
+    if (auto variableDefinition = castTo<ast::VariableDefinition::Ptr>(statement)) {
+        auto const symbol = variableDefinition->getVariableSymbol().lock();
+        auto const value = variableDefinition->getInitializer()->getConstantValue();
+        if (!value) {
+            logger.fatal() << "The initializer of the global variable " << symbol->getName()
+                           << " at line " << statement->getLine() << " is not a compile-time constant.";
+            exit(1);
+        }
+        global = {symbol->getName(), symbol->getType(), 1, {*value}};
+
+    } else if (auto arrayDefinition = castTo<ast::ArrayDefinition::Ptr>(statement)) {
+        auto const symbol = castTo<ast::ArraySymbol::Ptr>(arrayDefinition->getSymbol().lock());
+        global = {symbol->getName(), symbol->getType(), size_t(symbol->getSize()), {}};
+        for (auto const &expression : symbol->getContent()) {
+            auto const value = expression->getConstantValue();
+            if (!value) {
+                logger.fatal() << "The initializer of the global array " << symbol->getName()
+                               << " at line " << statement->getLine() << " is not a compile-time constant.";
+                exit(1);
             }
+            global.values.push_back(*value);
+        }
+
+    } else if (auto variableDeclaration = castTo<ast::VariableDeclaration::Ptr>(statement)) {
+        auto const symbol = variableDeclaration->getVariableSymbol().lock();
+        if (symbol->isDefined()) {
+            // The definition that follows emits it
+            return;
+        }
+        global = {symbol->getName(), symbol->getType(), 1, {}, true};
 
-            // old code:
-//            if (statement->shouldReturnAnIR()) {
-//                mBasicBlocks[0]->addInstruction(statement->getIR(mBasicBlocks[0]));
-//            } else if (statement->shouldReturnABasicBlock()) {
-//                mBasicBlocks.push_back(statement->getFunctionBasicBlock(this));
-//            } else {
-//                if (statement->getType() != ast::StatementType::FunctionDeclaration) {
-//                    logger.warning() << "[CFG] Statement return neither IR nor BB: " << statement->getType();
-//                }
-//            }
+    } else if (auto arrayDeclaration = castTo<ast::ArrayDeclaration::Ptr>(statement)) {
+        auto const symbol = castTo<ast::ArraySymbol::Ptr>(arrayDeclaration->getSymbol().lock());
+        if (symbol->isDefined()) {
+            return;
         }
+        if (symbol->getSize() == 0) {
+            // The size is unknown, the array can only be defined elsewhere
+            addSymbol(0, symbol->getName(), symbol->getType());
+            return;
+        }
+        global = {symbol->getName(), symbol->getType(), size_t(symbol->getSize()), {}, true};
+
+    } else {
+        logger.trace() << "[CFG] Skipping global statement of type " << statement->getType() << '.';
+        return;
     }
+
+    CARAMEL_DEBUG << "[CFG] New global " << global.name << " of " << global.length << " "
+                   << global.type->getIdentifier() << ".";
+    addSymbol(0, global.name, global.type);
+    mGlobalVariables.push_back(std::move(global));
 }
 
 void CFG::addBasicBlock(std::shared_ptr<BasicBlock> basicBlock) {
     mFunctionsBasicBlocks.push_back(basicBlock);
 }
 
-bool CFG::hasSymbol(size_t controlBlockId, std::string const &symbolName) {
-    return mSymbols[controlBlockId].find(symbolName) != mSymbols[controlBlockId].end()
-           || mSymbols[0].find(symbolName) != mSymbols[0].end();
+FunctionFrame &CFG::getFrame(size_t functionContext) {
+    if (functionContext >= mFrames.size()) {
+        logger.fatal() << "[CFG] No frame for the function context " << functionContext << ".";
+        exit(1);
+    }
+    return *mFrames[functionContext];
 }
 
-bool CFG::isSymbolParamArray(size_t controlBlockId, std::string const &symbolName) {
+FunctionFrame const &CFG::getFrame(size_t functionContext) const {
+    if (functionContext >= mFrames.size()) {
+        logger.fatal() << "[CFG] No frame for the function context " << functionContext << ".";
+        exit(1);
+    }
+    return *mFrames[functionContext];
+}
+
+FrameSlot const *CFG::findSlot(size_t controlBlockId, SymbolId id) const {
+    if (auto slot = getFrame(controlBlockId).find(id)) {
+        return slot;
+    }
+    return getFrame(0).find(id);
+}
+
+FrameSlot const *CFG::findSlot(size_t controlBlockId, std::string const &symbolName) const {
+    // A name that was never interned is in no frame, and the queries don't intern it
+    auto const id = findInterned(symbolName);
+    return id ? findSlot(controlBlockId, *id) : nullptr;
+}
+
+bool CFG::hasSymbol(size_t controlBlockId, std::string const &symbolName) const {
+    if (auto element = splitArrayElement(symbolName)) {
+        return hasSymbol(controlBlockId, element->first);
+    }
+    return findSlot(controlBlockId, symbolName) != nullptr;
+}
+
+bool CFG::isSymbolParamArray(size_t controlBlockId, std::string const &symbolName) const {
     if (!hasSymbol(controlBlockId, symbolName)) {
         logger.fatal() << "Calling CFG::isSymbolArray(" << controlBlockId << ", " << symbolName << ") on unregistered symbol.";
         exit(1);
     }
-    return mSymbolIsParamArray[controlBlockId][symbolName];
+    auto const id = findInterned(symbolName);
+    auto slot = id ? getFrame(controlBlockId).find(*id) : nullptr;
+    return slot && slot->isParamArray;
+}
+
+bool CFG::isSymbolGlobal(size_t controlBlockId, std::string const &symbolName) const {
+    auto const id = findInterned(symbolName);
+    return id && (controlBlockId == 0 || !getFrame(controlBlockId).find(*id)) && getFrame(0).find(*id);
 }
 
 long CFG::addParamArraySymbol(size_t controlBlockId, std::string const &symbolName, ast::PrimaryType::Ptr type) {
-    mSymbolIsParamArray[controlBlockId][symbolName] = true;
-    long index = mStackSize[controlBlockId] - type->getMemoryLength() / 8U - 4;
-    return addSymbol(controlBlockId, symbolName, type, index);
+    FunctionFrame &frame = getFrame(controlBlockId);
+    long index = frame.getStackTop() - long(type->getMemoryLength() / 8U) - 4;
+    index = addSymbol(controlBlockId, symbolName, type, index);
+    frame.find(intern(symbolName))->isParamArray = true;
+    return index;
 }
 
 long CFG::addArraySymbol(size_t controlBlockId,
@@ -102,25 +230,30 @@ long CFG::addArraySymbol(size_t controlBlockId,
         logger.fatal() << "You can't use 0-length arrays.";
         exit(1);
     }
-    for (size_t i = 0; i < length - 1; ++i) {
-        size_t ip = length - (i + 1);
-        logger.trace() << "[CFG] Adding array symbol element " << yellow << "@" << controlBlockId << magenta << ": "
-                       << grey << symbolName << "[" << ip << "]" << " of type " << type->getIdentifier();
-        addSymbol(controlBlockId, symbolName + '[' + std::to_string(ip) + ']', type);
+    CARAMEL_TRACE << "[CFG] Adding array symbol " << yellow << "@" << controlBlockId << magenta << ": "
+                   << grey << symbolName << "[" << length << "]" << " of type " << type->getIdentifier();
+    FunctionFrame &frame = getFrame(controlBlockId);
+
+    if (auto const id = findInterned(symbolName); id && frame.find(*id)) {
+        return addSymbol(controlBlockId, symbolName, type);
     }
-    logger.trace() << "[CFG] Adding array symbol element " << yellow << "@" << controlBlockId << magenta << ": "
-                   << grey << symbolName << "[0]" << " of type " << type->getIdentifier();
-    return addSymbol(controlBlockId, symbolName, type);
+
+    // The array is a single frame object, its elements are addressed from its base
+    addSymbol(controlBlockId, symbolName, type);
+    frame.setStackTop(frame.getStackTop() - long(type->getMemoryLength() / 8U * (length - 1)));
+    frame.find(intern(symbolName))->index = frame.getStackTop();
+    return frame.getStackTop();
 }
 
 long CFG::addSymbol(size_t controlBlockId, std::string const &symbolName, caramel::ast::PrimaryType::Ptr type) {
-    logger.trace() << "[CFG] Adding symbol " << yellow << "@" << controlBlockId << magenta << ": "
+    SymbolId const id = intern(symbolName);
+    CARAMEL_TRACE << "[CFG] Adding symbol " << yellow << "@" << controlBlockId << magenta << ": "
                    << grey << symbolName << " of type " << type->getIdentifier();
+    FunctionFrame &frame = getFrame(controlBlockId);
 
-    if (hasSymbol(controlBlockId, symbolName)) {
-        long existingIndex = getSymbolIndex(controlBlockId, symbolName);
-        logger.warning() << "[CFG] Symbol " << symbolName << " already exists with index " << existingIndex << ".";
-        return existingIndex;
+    if (auto existing = frame.find(id)) {
+        logger.warning() << "[CFG] Symbol " << symbolName << " already exists with index " << existing->index << ".";
+        return existing->index;
     }
 
     if (type->getMemoryLength() == 0) {
@@ -128,54 +261,50 @@ long CFG::addSymbol(size_t controlBlockId, std::string const &symbolName, carame
         exit(1);
     }
 
-    if (mSymbolIsParamArray[controlBlockId].find(symbolName) == mSymbolIsParamArray[controlBlockId].end()) {
-        mSymbolIsParamArray[controlBlockId][symbolName] = false;
-    }
-    mSymbols[controlBlockId][symbolName] = type;
-    mStackSize[controlBlockId] = mStackSize[controlBlockId] - type->getMemoryLength() / 8U;
-    mTopStackMemberSize[controlBlockId] = type->getMemoryLength();
-    mSymbolIndex[controlBlockId][symbolName] = mStackSize[controlBlockId];
+    frame.setStackTop(frame.getStackTop() - long(type->getMemoryLength() / 8U));
+    frame.setTopMemberSize(type->getMemoryLength());
+    frame.addSlot(id, type, frame.getStackTop());
 
-    logger.trace() << "[CFG] " << "  => " << mStackSize[controlBlockId];
-    return mStackSize[controlBlockId];
+    logger.trace() << "[CFG] " << "  => " << frame.getStackTop();
+    return frame.getStackTop();
 }
 
 long CFG::addSymbol(size_t controlBlockId, std::string const &symbolName, ast::PrimaryType::Ptr type, long index) {
-    logger.trace() << "[CFG] Adding symbol: " << grey << symbolName << " of type " << type->getIdentifier()
+    SymbolId const id = intern(symbolName);
+    CARAMEL_TRACE << "[CFG] Adding symbol: " << grey << symbolName << " of type " << type->getIdentifier()
                    << yellow << " at " << index;
+    FunctionFrame &frame = getFrame(controlBlockId);
 
-    if (hasSymbol(controlBlockId, symbolName)) {
-        long existingIndex = getSymbolIndex(controlBlockId, symbolName);
-        logger.warning() << "[CFG] Symbol " << symbolName << "already exists with index " << existingIndex << ".";
-        return existingIndex;
+    if (auto existing = frame.find(id)) {
+        logger.warning() << "[CFG] Symbol " << symbolName << "already exists with index " << existing->index << ".";
+        return existing->index;
     }
 
-    if (mSymbolIsParamArray[controlBlockId].find(symbolName) == mSymbolIsParamArray[controlBlockId].end()) {
-        mSymbolIsParamArray[controlBlockId][symbolName] = false;
-    }
-    mSymbols[controlBlockId][symbolName] = type;
-    mSymbolIndex[controlBlockId][symbolName] = index;
-    mTopStackMemberSize[controlBlockId] = type->getMemoryLength();
+    frame.setTopMemberSize(type->getMemoryLength());
+    frame.addSlot(id, type, index);
     if (index < 0) {
-        mStackSize[controlBlockId] = size_t(index);
+        frame.setStackTop(index);
     }
 
     logger.trace() << "[CFG] " << "  => " << index;
     return index;
 }
 
-long CFG::getSymbolIndex(size_t controlBlockId, std::string const &symbolName) {
-    if (mSymbolIndex[controlBlockId].find(symbolName) != mSymbolIndex[controlBlockId].end()) {
-        return mSymbolIndex[controlBlockId][symbolName];
-    } else if (mSymbolIndex[0].find(symbolName) != mSymbolIndex[0].end()) {
-        return mSymbolIndex[0][symbolName];
-    } else {
-        return 0;
+long CFG::getSymbolIndex(size_t controlBlockId, std::string const &symbolName) const {
+    if (auto element = splitArrayElement(symbolName)) {
+        auto const &[arrayName, index] = *element;
+        auto const arraySlot = findSlot(controlBlockId, arrayName);
+        if (!arraySlot) {
+            return 0;
+        }
+        return arraySlot->index + index * long(arraySlot->type->getMemoryLength() / 8U);
     }
+    auto const slot = findSlot(controlBlockId, symbolName);
+    return slot ? slot->index : 0;
 }
 
 void CFG::enterFunction(size_t controlBlockId) {
-    mStackSize[controlBlockId] = 0;
+    getFrame(controlBlockId).setStackTop(0);
     // FIXME: This won't work for nested BB
 }
 
@@ -184,11 +313,16 @@ void CFG::leaveFunction(size_t controlBlockId) {
 }
 
 std::shared_ptr<BasicBlock> CFG::generateBasicBlock(std::string entryName) {
-    return std::make_shared<BasicBlock>(++mNextBasicBlockNumber, mNextFunctionContext, this, entryName);
+    FunctionFrame &frame = FunctionFrame::lowered();
+    auto basicBlock = utils::makeNode<BasicBlock>(frame.nextBasicBlockNumber(), frame.getFunctionContext(), this,
+                                                  entryName, frame.shared_from_this());
+    frame.addBasicBlock(basicBlock);
+    return basicBlock;
 }
 
 std::shared_ptr<BasicBlock> CFG::generateFunctionBlock(std::string entryName) {
-    return std::make_shared<BasicBlock>(++mNextBasicBlockNumber, ++mNextFunctionContext, this, entryName);
+    // The frame was reserved before lowering the function
+    return generateBasicBlock(std::move(entryName));
 }
 
 std::vector<std::shared_ptr<BasicBlock>> &CFG::getBasicBlocks() {
@@ -199,43 +333,48 @@ std::string &CFG::getFileName() {
     return mFileName;
 }
 
+Config const &CFG::getConfig() const {
+    return mConfig;
+}
+
+std::vector<GlobalVariable> const &CFG::getGlobalVariables() const {
+    return mGlobalVariables;
+}
+
 std::ostream &operator<<(std::ostream &os, CFG const &cfg) {
     os << "CFG:\n"
        << " - mFileName: " << cfg.mFileName << '\n'
        << " - mRootContext: " << *cfg.mRootContext << '\n'
-       << " - mSymbols & mSymbolsIndex:\n";
-    for (auto const &[functionContextId, symbols] : cfg.mSymbols) {
-        for (auto const &[name, type] : symbols) {
-            os << "    - BB=" << functionContextId
-               << ", name=" << name
-               << ", type=" << type->getIdentifier()
-               << ", index=" << cfg.mSymbolIndex.at(functionContextId).at(name)
-               << ", isParamArray=" << std::boolalpha << cfg.mSymbolIsParamArray.at(functionContextId).at(name)
+       << " - mFrames:\n";
+    for (auto const &frame : cfg.mFrames) {
+        os << "    - BB=" << frame->getFunctionContext()
+           << ", stackTop=" << frame->getStackTop()
+           << ", topMemberSize=" << frame->getTopMemberSize() << '\n';
+        for (auto const &slot : frame->getSlots()) {
+            os << "      - name=" << internedString(slot.id)
+               << ", type=" << slot.type->getIdentifier()
+               << ", index=" << slot.index
+               << ", isParamArray=" << std::boolalpha << slot.isParamArray
                << '\n';
         }
     }
-    os << " - mStackSize:\n";
-    for (auto const &[basicBlockId, size] : cfg.mStackSize) {
-        os << "    - BB=" << basicBlockId << ", size=" << size << '\n';
-    }
-    os << " - mTopStackMemberSize:\n";
-    for (auto const &[basicBlockId, size] : cfg.mTopStackMemberSize) {
-        os << "    - BB=" << basicBlockId << ", size=" << size << '\n';
-    }
-    os << " - mNextBasicBlockNumber: " << cfg.mNextBasicBlockNumber << '\n'
-       << " - mBasicBlocks: " << cfg.mFunctionsBasicBlocks.size() << " BBs";
+    os << " - mBasicBlocks: " << cfg.mFunctionsBasicBlocks.size() << " BBs";
     return os;
 }
 
 std::shared_ptr<BasicBlock> CFG::generateNamedBasicBlock() {
-    return std::make_shared<BasicBlock>(++mNextBasicBlockNumber, mNextFunctionContext, this,
-                                        BasicBlock::getNextNumberName());
+    return generateLabeledBasicBlock("");
+}
+
+std::shared_ptr<BasicBlock> CFG::generateLabeledBasicBlock(std::string labelSuffix) {
+    auto basicBlock = generateBasicBlock();
+    basicBlock->setLabel(FunctionFrame::lowered().getNaming().newLabel(), std::move(labelSuffix));
+    return basicBlock;
 }
 
 size_t CFG::getStackSize(size_t functionBasicBlockIndex) const {
-    long topStackMemberSize = mTopStackMemberSize.find(functionBasicBlockIndex) == mTopStackMemberSize.end()
-                              ? 0U : mTopStackMemberSize.at(functionBasicBlockIndex);
-    long stackSize = -mStackSize.at(functionBasicBlockIndex) + topStackMemberSize / 8U;
+    FunctionFrame const &frame = getFrame(functionBasicBlockIndex);
+    long stackSize = -frame.getStackTop() + long(frame.getTopMemberSize() / 8U);
     if (stackSize < 0) {
         logger.fatal() << "Negative stack size: " << stackSize << ". CFG: " << *this;
         exit(0);
@@ -244,34 +383,35 @@ size_t CFG::getStackSize(size_t functionBasicBlockIndex) const {
 }
 
 void CFG::addFunctionBBEnd(size_t functionId, BasicBlock::Ptr functionBBEnd) {
-    mFunctionBBEnd[functionId] = std::move(functionBBEnd);
+    getFrame(functionId).setFunctionEnd(functionBBEnd);
 }
 
-std::shared_ptr<BasicBlock> CFG::getFunctionEndBasicBlock(size_t functionBasicBlockIndex) {
-    return mFunctionBBEnd.at(functionBasicBlockIndex);
+std::shared_ptr<BasicBlock> CFG::getFunctionEndBasicBlock(size_t functionBasicBlockIndex) const {
+    return getFrame(functionBasicBlockIndex).getFunctionEnd();
 }
 
 void CFG::pushCurrentControlBlockEndBB(BasicBlock::Ptr bbend) {
     logger.trace() << "[CFG] Pushing control-block end-BB: " << bbend->getLabelName();
 
-    mControlBlockEndBBStack.push(bbend);
+    FunctionFrame::lowered().pushControlBlockEnd(bbend);
 }
 
 void CFG::popCurrentControlBlockEndBB() {
     logger.trace() << "[CFG] Popping control-block end-BB.";
 
-    mControlBlockEndBBStack.pop();
+    FunctionFrame::lowered().popControlBlockEnd();
 }
 
 BasicBlock::Ptr CFG::getCurrentControlBlockEndBB() {
     logger.trace() << "[CFG] Getting control-block end-BB:";
 
-    if (mControlBlockEndBBStack.empty()) {
+    BasicBlock::Ptr controlBlockEnd = FunctionFrame::lowered().getControlBlockEnd();
+    if (!controlBlockEnd) {
         logger.fatal() << "The control-block end-BB stack is empty!";
         exit(1);
     }
-    logger.trace() << "[CFG] => " << mControlBlockEndBBStack.top()->getLabelName();
-    return mControlBlockEndBBStack.top();
+    logger.trace() << "[CFG] => " << controlBlockEnd->getLabelName();
+    return controlBlockEnd;
 }
 
 } // namespace caramel::ir
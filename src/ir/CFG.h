@@ -27,29 +27,45 @@
 #include "../ast/statements/Statement.h"
 #include "../ast/symboltable/Symbol.h"
 #include "../ast/context/Context.h"
+#include "../Config.h"
+#include "../utils/StringInterner.h"
+#include "FunctionFrame.h"
 #include "BasicBlock.h"
 
 #include <ostream>
-#include <stack>
+#include <vector>
 
 namespace caramel::ir {
 
 class BasicBlock;
 
+/**
+ * A global variable or array, with its compile-time initial value.
+ */
+struct GlobalVariable {
+    std::string name;
+    ast::PrimaryType::Ptr type;
+    size_t length;
+    std::vector<long long> values;
+    // Declared extern without a definition in this file: a common symbol, merged with a definition elsewhere
+    bool common = false;
+};
+
 class CFG {
 public:
     using Ptr = std::shared_ptr<CFG>;
     using WeakPtr = std::weak_ptr<CFG>;
 
 public:
-    explicit CFG(std::string const &fileName, ast::Context::Ptr ast);
-    virtual ~CFG() = default;
+    explicit CFG(std::string const &fileName, ast::Context::Ptr ast, Config const &config);
+    virtual ~CFG();
 
 public:
 
     std::shared_ptr<BasicBlock> generateBasicBlock(std::string entryName = "");
     std::shared_ptr<BasicBlock> generateFunctionBlock(std::string entryName);
     std::shared_ptr<BasicBlock> generateNamedBasicBlock();
+    std::shared_ptr<BasicBlock> generateLabeledBasicBlock(std::string labelSuffix);
 
 
     void addBasicBlock(
@@ -57,15 +73,19 @@ public:
     );
     std::vector<std::shared_ptr<BasicBlock>> & getBasicBlocks();
 
-    bool hasSymbol(size_t controlBlockId, std::string const &symbolName);
-    bool isSymbolParamArray(size_t controlBlockId, std::string const &symbolName);
+    FunctionFrame &getFrame(size_t functionContext);
+    FunctionFrame const &getFrame(size_t functionContext) const;
+
+    bool hasSymbol(size_t controlBlockId, std::string const &symbolName) const;
+    bool isSymbolParamArray(size_t controlBlockId, std::string const &symbolName) const;
+    bool isSymbolGlobal(size_t controlBlockId, std::string const &symbolName) const;
     long addParamArraySymbol(size_t controlBlockId, std::string const &symbolName, ast::PrimaryType::Ptr type);
     long addArraySymbol(size_t controlBlockId, std::string const &symbolName, ast::PrimaryType::Ptr type, size_t length);
     long addSymbol(size_t controlBlockId, std::string const &symbolName, ast::PrimaryType::Ptr type);
     long addSymbol(size_t controlBlockId, std::string const &symbolName, ast::PrimaryType::Ptr type, long index);
-    long getSymbolIndex(size_t controlBlockId, std::string const &symbolName);
+    long getSymbolIndex(size_t controlBlockId, std::string const &symbolName) const;
 
-    std::shared_ptr<BasicBlock> getFunctionEndBasicBlock(size_t functionBasicBlockIndex);
+    std::shared_ptr<BasicBlock> getFunctionEndBasicBlock(size_t functionBasicBlockIndex) const;
 
     void pushCurrentControlBlockEndBB(std::shared_ptr<BasicBlock> bbend);
     void popCurrentControlBlockEndBB();
@@ -80,26 +100,29 @@ public:
 
     std::string & getFileName();
 
+    std::vector<GlobalVariable> const & getGlobalVariables() const;
+
+    Config const & getConfig() const;
+
     friend std::ostream &operator<<(std::ostream &os, CFG const &cfg);
 
+protected:
+    void addGlobalVariable(ast::Statement::Ptr const &statement);
+    FrameSlot const *findSlot(size_t controlBlockId, utils::SymbolId id) const;
+    FrameSlot const *findSlot(size_t controlBlockId, std::string const &symbolName) const;
+
 protected:
     std::string mFileName;
     ast::Context::Ptr mRootContext;
+    Config mConfig;
 
-    std::map<size_t, std::map<std::string, ast::PrimaryType::Ptr>> mSymbols;
-    std::map<size_t, std::map<std::string, long>> mSymbolIndex;
-    std::map<size_t, std::map<std::string, bool>> mSymbolIsParamArray;
-    std::map<size_t, long> mStackSize;
-    std::map<size_t, long> mTopStackMemberSize;
-
-    int mNextBasicBlockNumber;
-    int mNextFunctionContext;
+    /**
+     * One frame per function context, indexed by it. The frame 0 holds the globals.
+     */
+    std::vector<FunctionFrame::Ptr> mFrames;
 
     std::vector<std::shared_ptr<BasicBlock>> mFunctionsBasicBlocks;
-    std::map<size_t, std::shared_ptr<BasicBlock>> mFunctionBBEnd;
-    std::vector<caramel::ast::Declaration::Ptr> mGlobalContext;
-
-    std::stack<std::shared_ptr<BasicBlock>> mControlBlockEndBBStack;
+    std::vector<GlobalVariable> mGlobalVariables;
 };
 
 } // namespace caramel::ast
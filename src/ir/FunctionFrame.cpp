@@ -0,0 +1,147 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "FunctionFrame.h"
+#include "BasicBlock.h"
+#include "../Logger.h"
+
+#include <cstdlib>
+
+namespace caramel::ir {
+
+FunctionFrame::FunctionFrame(size_t functionContext)
+        : mFunctionContext{functionContext},
+          mSlots{},
+          mSlotIndex{},
+          mStackTop{0},
+          mTopMemberSize{0},
+          mNextBasicBlockNumber{0},
+          mNaming{functionContext},
+          mControlBlockEndStack{},
+          mFunctionEnd{},
+          mBasicBlocks{} {}
+
+size_t FunctionFrame::getFunctionContext() const {
+    return mFunctionContext;
+}
+
+FrameSlot *FunctionFrame::find(utils::SymbolId id) {
+    auto it = mSlotIndex.find(id);
+    return it == mSlotIndex.end() ? nullptr : &mSlots[it->second];
+}
+
+FrameSlot const *FunctionFrame::find(utils::SymbolId id) const {
+    auto it = mSlotIndex.find(id);
+    return it == mSlotIndex.end() ? nullptr : &mSlots[it->second];
+}
+
+FrameSlot &FunctionFrame::addSlot(utils::SymbolId id, ast::PrimaryType::Ptr type, long index) {
+    mSlotIndex.emplace(id, mSlots.size());
+    mSlots.push_back({id, std::move(type), index, false});
+    return mSlots.back();
+}
+
+std::vector<FrameSlot> const &FunctionFrame::getSlots() const {
+    return mSlots;
+}
+
+long FunctionFrame::getStackTop() const {
+    return mStackTop;
+}
+
+void FunctionFrame::setStackTop(long stackTop) {
+    mStackTop = stackTop;
+}
+
+size_t FunctionFrame::getTopMemberSize() const {
+    return mTopMemberSize;
+}
+
+void FunctionFrame::setTopMemberSize(size_t topMemberSize) {
+    mTopMemberSize = topMemberSize;
+}
+
+size_t FunctionFrame::nextBasicBlockNumber() {
+    return ++mNextBasicBlockNumber;
+}
+
+NamingContext &FunctionFrame::getNaming() {
+    return mNaming;
+}
+
+void FunctionFrame::pushControlBlockEnd(std::shared_ptr<BasicBlock> const &controlBlockEnd) {
+    mControlBlockEndStack.push_back(controlBlockEnd);
+}
+
+void FunctionFrame::popControlBlockEnd() {
+    mControlBlockEndStack.pop_back();
+}
+
+std::shared_ptr<BasicBlock> FunctionFrame::getControlBlockEnd() const {
+    return mControlBlockEndStack.empty() ? nullptr : mControlBlockEndStack.back();
+}
+
+void FunctionFrame::setFunctionEnd(std::shared_ptr<BasicBlock> const &functionEnd) {
+    mFunctionEnd = functionEnd;
+}
+
+std::shared_ptr<BasicBlock> const &FunctionFrame::getFunctionEnd() const {
+    return mFunctionEnd;
+}
+
+void FunctionFrame::addBasicBlock(std::shared_ptr<BasicBlock> const &basicBlock) {
+    mBasicBlocks.push_back(basicBlock);
+}
+
+void FunctionFrame::releaseBasicBlocks() {
+    mControlBlockEndStack.clear();
+    mFunctionEnd.reset();
+    for (auto const &weakBasicBlock : mBasicBlocks) {
+        if (auto basicBlock = weakBasicBlock.lock()) {
+            basicBlock->unlink();
+        }
+    }
+    mBasicBlocks.clear();
+}
+
+thread_local FunctionFrame *FunctionFrame::sLowered = nullptr;
+
+FunctionFrame &FunctionFrame::lowered() {
+    if (!sLowered) {
+        logger.fatal() << "No function is being lowered by this thread.";
+        exit(1);
+    }
+    return *sLowered;
+}
+
+LoweringScope::LoweringScope(FunctionFrame &frame)
+        : mPrevious{FunctionFrame::sLowered} {
+    FunctionFrame::sLowered = &frame;
+}
+
+LoweringScope::~LoweringScope() {
+    FunctionFrame::sLowered = mPrevious;
+}
+
+} // namespace caramel::ir
@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "../ast/symboltable/PrimaryType.h"
+#include "NamingContext.h"
+#include "../utils/StringInterner.h"
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+namespace caramel::ir {
+
+class BasicBlock;
+
+/**
+ * A symbol living in a function frame, at the given offset (in 8-byte units) from %rbp.
+ */
+struct FrameSlot {
+    utils::SymbolId id;
+    ast::PrimaryType::Ptr type;
+    long index;
+    bool isParamArray;
+};
+
+/**
+ * The symbols of a function context, stored contiguously, with a hash index on their ids.
+ * The frame of the context 0 holds the global variables.
+ *
+ * The frame also holds the state used while lowering its function, so that
+ * functions can be lowered independently, and concurrently.
+ */
+class FunctionFrame : public std::enable_shared_from_this<FunctionFrame> {
+public:
+    using Ptr = std::shared_ptr<FunctionFrame>;
+
+    explicit FunctionFrame(size_t functionContext);
+    virtual ~FunctionFrame() = default;
+
+    size_t getFunctionContext() const;
+
+    FrameSlot *find(utils::SymbolId id);
+    FrameSlot const *find(utils::SymbolId id) const;
+
+    FrameSlot &addSlot(utils::SymbolId id, ast::PrimaryType::Ptr type, long index);
+
+    std::vector<FrameSlot> const &getSlots() const;
+
+    long getStackTop() const;
+    void setStackTop(long stackTop);
+
+    size_t getTopMemberSize() const;
+    void setTopMemberSize(size_t topMemberSize);
+
+    //------------------------------------------------------------------------------------------------------------------
+    // Lowering state
+
+    size_t nextBasicBlockNumber();
+    NamingContext &getNaming();
+
+    void pushControlBlockEnd(std::shared_ptr<BasicBlock> const &controlBlockEnd);
+    void popControlBlockEnd();
+    std::shared_ptr<BasicBlock> getControlBlockEnd() const;
+
+    void setFunctionEnd(std::shared_ptr<BasicBlock> const &functionEnd);
+    std::shared_ptr<BasicBlock> const &getFunctionEnd() const;
+
+    void addBasicBlock(std::shared_ptr<BasicBlock> const &basicBlock);
+
+    /**
+     * Unlinks the basic blocks of the function, which make reference cycles through the loops and the instructions.
+     */
+    void releaseBasicBlocks();
+
+    /**
+     * The frame of the function being lowered by the calling thread.
+     */
+    static FunctionFrame &lowered();
+
+private:
+    friend class LoweringScope;
+    static thread_local FunctionFrame *sLowered;
+
+
+    size_t mFunctionContext;
+    std::vector<FrameSlot> mSlots;
+    std::unordered_map<utils::SymbolId, size_t> mSlotIndex;
+    long mStackTop;
+    size_t mTopMemberSize;
+
+    size_t mNextBasicBlockNumber;
+    NamingContext mNaming;
+    std::vector<std::shared_ptr<BasicBlock>> mControlBlockEndStack;
+    std::shared_ptr<BasicBlock> mFunctionEnd;
+    std::vector<std::weak_ptr<BasicBlock>> mBasicBlocks;
+};
+
+/**
+ * Makes a frame the lowered one of the calling thread for its lifetime.
+ */
+class LoweringScope {
+public:
+    explicit LoweringScope(FunctionFrame &frame);
+    ~LoweringScope();
+
+    LoweringScope(LoweringScope const &) = delete;
+    LoweringScope &operator=(LoweringScope const &) = delete;
+
+private:
+    FunctionFrame *mPrevious;
+};
+
+} // namespace caramel::ir
@@ -62,7 +62,10 @@ enum class Operation {
     leave,
     nope,
     popq,
-    ftr // equivalent of ser
+    ftr, // equivalent of ser
+    vloop,
+    jtable,
+    ainit
 };
 
 class IR {
@@ -77,6 +80,7 @@ public:
     static constexpr const char* DEST_REG = "%rdi";
     static constexpr const char* BASE_POINTER_REG = "%rbp";
     static constexpr const char* STACK_POINTER_REG = "%rsp";
+    static constexpr const char* INSTRUCTION_POINTER_REG = "%rip";
     static constexpr const char* ACCUMULATOR = "%rax";
     static constexpr const char* ACCUMULATOR_1 = "%r10"; // FIXME: deprecated
     static constexpr const char* ACCUMULATOR_2 = "%r11"; // FIXME: deprecated
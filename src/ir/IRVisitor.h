@@ -64,6 +64,9 @@ class RightShiftInstruction;
 class BitwiseAndInstruction;
 class BitwiseOrInstruction;
 class BitwiseXorInstruction;
+class VectorLoopInstruction;
+class JumpTableInstruction;
+class ArrayInitInstruction;
 
 
 class IRVisitor {
@@ -194,6 +197,21 @@ public:
             std::ostream &os
     ) = 0;
 
+    virtual void visitVectorLoop(
+            VectorLoopInstruction *instruction,
+            std::ostream &os
+    ) = 0;
+
+    virtual void visitJumpTable(
+            JumpTableInstruction *instruction,
+            std::ostream &os
+    ) = 0;
+
+    virtual void visitArrayInit(
+            ArrayInitInstruction *instruction,
+            std::ostream &os
+    ) = 0;
+
 };
 
 } // namespace caramel::ir
@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "NamingContext.h"
+
+namespace caramel::ir {
+
+NamingContext::NamingContext(size_t functionContext)
+        : mFunctionContext{functionContext},
+          mNextLabel{0},
+          mNextTemporary{0},
+          mNextLogicalOperator{0} {}
+
+uint32_t NamingContext::newLabel() {
+    return mNextLabel++;
+}
+
+uint32_t NamingContext::newTemporary() {
+    return mNextTemporary++;
+}
+
+uint32_t NamingContext::newLogicalOperator() {
+    return ++mNextLogicalOperator;
+}
+
+std::string NamingContext::getLabelName(uint32_t label) const {
+    return ".L" + std::to_string(mFunctionContext) + "_" + std::to_string(label);
+}
+
+std::string NamingContext::newLabelName(std::string const &suffix) {
+    return getLabelName(newLabel()) + suffix;
+}
+
+std::string NamingContext::getTemporaryName(uint32_t temporary) {
+    return "!tmp" + std::to_string(temporary);
+}
+
+std::string NamingContext::newTemporaryName() {
+    return getTemporaryName(newTemporary());
+}
+
+} // namespace caramel::ir
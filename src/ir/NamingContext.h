@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace caramel::ir {
+
+/**
+ * Gives the names of a function: labels, temporaries and logical operators.
+ *
+ * Names are compact numbers, local to the function, so that they don't depend on
+ * the other functions nor on the order in which the functions are lowered.
+ * They are only turned into text when needed, e.g. BasicBlock::getLabelName().
+ */
+class NamingContext {
+public:
+    explicit NamingContext(size_t functionContext);
+
+    uint32_t newLabel();
+    uint32_t newTemporary();
+    uint32_t newLogicalOperator();
+
+    /// Labels are file-wide, so they are qualified by the function context.
+    std::string getLabelName(uint32_t label) const;
+    std::string newLabelName(std::string const &suffix = "");
+
+    static std::string getTemporaryName(uint32_t temporary);
+    std::string newTemporaryName();
+
+private:
+    size_t mFunctionContext;
+    uint32_t mNextLabel;
+    uint32_t mNextTemporary;
+    uint32_t mNextLogicalOperator;
+};
+
+} // namespace caramel::ir
@@ -32,7 +32,7 @@
           return block->addInstruction(__tmp_instr__);})()
 
 #define MOVE_TO(var, to, max)                                                                       \
-currentBasicBlock->addInstruction(std::make_shared<ir::CopyInstruction>(                            \
+currentBasicBlock->addInstruction(utils::makeNode<ir::CopyInstruction>(                            \
     currentBasicBlock,                                                                              \
     max,                                                                                            \
     to,                                                                                             \
@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "VectorLoopInstruction.h"
+#include "../IRVisitor.h"
+
+namespace caramel::ir {
+
+VectorLoopInstruction::VectorLoopInstruction(
+        std::shared_ptr<ir::BasicBlock> const &parentBlock,
+        ast::PrimaryType::Ptr const &counterType,
+        std::string const &counter,
+        std::string label,
+        long long begin,
+        long long end,
+        size_t lanes,
+        VectorOperation vectorOperation,
+        bool isReduction,
+        std::string destination,
+        std::string left,
+        std::string right,
+        bool isRightConstant
+) : IR(counter, Operation::vloop, parentBlock, counterType),
+    mLabel{std::move(label)},
+    mBegin{begin},
+    mEnd{end},
+    mLanes{lanes},
+    mVectorOperation{vectorOperation},
+    mIsReduction{isReduction},
+    mDestination{std::move(destination)},
+    mLeft{std::move(left)},
+    mRight{std::move(right)},
+    mIsRightConstant{isRightConstant} {}
+
+void VectorLoopInstruction::accept(std::shared_ptr<IRVisitor> const &visitor, std::ostream &os) {
+    visitor->visitVectorLoop(this, os);
+}
+
+std::string VectorLoopInstruction::getCounter() const {
+    return getReturnName();
+}
+
+std::string VectorLoopInstruction::getLabel() const {
+    return mLabel;
+}
+
+long long VectorLoopInstruction::getBegin() const {
+    return mBegin;
+}
+
+long long VectorLoopInstruction::getEnd() const {
+    return mEnd;
+}
+
+size_t VectorLoopInstruction::getLanes() const {
+    return mLanes;
+}
+
+VectorOperation VectorLoopInstruction::getVectorOperation() const {
+    return mVectorOperation;
+}
+
+bool VectorLoopInstruction::isReduction() const {
+    return mIsReduction;
+}
+
+std::string VectorLoopInstruction::getDestination() const {
+    return mDestination;
+}
+
+std::string VectorLoopInstruction::getLeft() const {
+    return mLeft;
+}
+
+std::string VectorLoopInstruction::getRight() const {
+    return mRight;
+}
+
+bool VectorLoopInstruction::isRightConstant() const {
+    return mIsRightConstant;
+}
+
+std::ostream & operator<< (std::ostream & os, VectorOperation const & vectorOperation) {
+    switch (vectorOperation) {
+        case VectorOperation::Add: return os << "+";
+        case VectorOperation::Sub: return os << "-";
+        case VectorOperation::And: return os << "&";
+        case VectorOperation::Or: return os << "|";
+        case VectorOperation::Xor: return os << "^";
+    }
+    return os;
+}
+
+} // namespace caramel::ir
@@ -0,0 +1,110 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "../IR.h"
+
+namespace caramel::ir {
+
+enum class VectorOperation {
+    Add,
+    Sub,
+    And,
+    Or,
+    Xor
+};
+
+/**
+ * A counted loop working on 32-bit arrays, processed several lanes at a time.
+ * Iterates from begin (included) to end (excluded), end - begin being a multiple
+ * of the number of lanes, and leaves end in the counter.
+ *   - element-wise: destination[i] = left[i] op right[i], right being an array or a constant
+ *   - reduction:    destination = destination op right[i]
+ */
+class VectorLoopInstruction : public IR {
+public:
+    using Ptr = std::shared_ptr<VectorLoopInstruction>;
+    using WeakPtr = std::shared_ptr<VectorLoopInstruction>;
+
+public:
+    explicit VectorLoopInstruction(
+            std::shared_ptr<BasicBlock> const &parentBlock,
+            ast::PrimaryType::Ptr const &counterType,
+            std::string const &counter,
+            std::string label,
+            long long begin,
+            long long end,
+            size_t lanes,
+            VectorOperation vectorOperation,
+            bool isReduction,
+            std::string destination,
+            std::string left,
+            std::string right,
+            bool isRightConstant
+    );
+
+    ~VectorLoopInstruction() override = default;
+
+    std::string getCounter() const;
+
+    std::string getLabel() const;
+
+    long long getBegin() const;
+
+    long long getEnd() const;
+
+    size_t getLanes() const;
+
+    VectorOperation getVectorOperation() const;
+
+    bool isReduction() const;
+
+    std::string getDestination() const;
+
+    std::string getLeft() const;
+
+    std::string getRight() const;
+
+    bool isRightConstant() const;
+
+private:
+    void accept(std::shared_ptr<IRVisitor> const &visitor, std::ostream &os) override;
+
+private:
+    std::string mLabel;
+    long long mBegin;
+    long long mEnd;
+    size_t mLanes;
+    VectorOperation mVectorOperation;
+    bool mIsReduction;
+    std::string mDestination;
+    std::string mLeft;
+    std::string mRight;
+    bool mIsRightConstant;
+};
+
+std::ostream & operator<< (std::ostream & os, VectorOperation const & vectorOperation);
+
+} // namespace caramel::ir
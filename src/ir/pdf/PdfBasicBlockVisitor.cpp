@@ -87,6 +87,11 @@ void PdfBasicBlockVisitor::generateAssembly(std::shared_ptr<ir::BasicBlock> cons
            << " -> " << "bb" << replace_leading_dot(basicBlock->getNextWhenFalse()->getLabelName())
            << "[label=\"False\"];\n";
     }
+    for (auto const &jumpTarget : basicBlock->getJumpTargets()) {
+        os << "\tbb" << mLabelName
+           << " -> " << "bb" << replace_leading_dot(jumpTarget->getLabelName())
+           << "[style=dashed];\n";
+    }
 }
 
 } // namespace caramel::ir::Pdf
@@ -35,9 +35,9 @@ void PdfCFGVisitor::generateAssembly(std::shared_ptr<ir::CFG> const &controlFlow
     os << std::endl;
 
     for (auto const &function_root_bb : controlFlowGraph->getBasicBlocks()) {
-        generateAssembly(controlFlowGraph, os, function_root_bb->getId(), function_root_bb);
+        generateAssembly(controlFlowGraph, os, function_root_bb->getFunctionContext(), function_root_bb);
 
-        auto &order = mOrders[function_root_bb->getId()];
+        auto &order = mOrders[function_root_bb->getFunctionContext()];
         for (auto it = order.rbegin(), end_it = order.rend(); it != end_it; ++it) {
             mBasicBlockVisitor->generateAssembly(*it, os);
         }
@@ -52,10 +52,11 @@ void PdfCFGVisitor::generateAssembly(
         std::ostream &os,
         size_t functionRootId,
         ir::BasicBlock::Ptr bb) {
-    if (mVisitedBB.find(bb->getId()) != mVisitedBB.end()) {
+    // The basic block ids are only unique within a function
+    if (mVisitedBB.find(bb.get()) != mVisitedBB.end()) {
         return;
     }
-    mVisitedBB.insert(bb->getId());
+    mVisitedBB.insert(bb.get());
 
     if (bb->getNextWhenFalse()) {
         generateAssembly(controlFlowGraph, os, functionRootId , bb->getNextWhenFalse());
@@ -63,6 +64,10 @@ void PdfCFGVisitor::generateAssembly(
     if (bb->getNextWhenTrue()) {
         generateAssembly(controlFlowGraph, os, functionRootId , bb->getNextWhenTrue());
     }
+    auto const &jumpTargets = bb->getJumpTargets();
+    for (auto it = jumpTargets.rbegin(), end_it = jumpTargets.rend(); it != end_it; ++it) {
+        generateAssembly(controlFlowGraph, os, functionRootId , *it);
+    }
 
     mOrders[functionRootId].push_back(bb);
 }
@@ -68,7 +68,7 @@ public:
 private:
     std::shared_ptr<PdfBasicBlockVisitor> mBasicBlockVisitor;
     std::map<size_t, std::vector<ir::BasicBlock::Ptr>> mOrders;
-    std::set<size_t> mVisitedBB;
+    std::set<ir::BasicBlock const *> mVisitedBB;
 };
 
 } // namespace caramel::ir::Pdf
@@ -48,6 +48,9 @@
 #include "../instructions/BitwiseAndInstruction.h"
 #include "../instructions/BitwiseOrInstruction.h"
 #include "../instructions/BitwiseXorInstruction.h"
+#include "../instructions/VectorLoopInstruction.h"
+#include "../instructions/JumpTableInstruction.h"
+#include "../instructions/ArrayInitInstruction.h"
 
 
 namespace caramel::ir::Pdf {
@@ -220,4 +223,34 @@ void PdfIRVisitor::visitBitwiseXor(BitwiseXorInstruction *instruction, std::ostr
        << instruction->getLeft() << " ^ " << instruction->getRight();
 }
 
+void PdfIRVisitor::visitVectorLoop(VectorLoopInstruction *instruction, std::ostream &os) {
+    os << "vector loop (x" << instruction->getLanes() << "): "
+       << instruction->getCounter() << " in [" << instruction->getBegin() << ", " << instruction->getEnd() << "[, ";
+    if (instruction->isReduction()) {
+        os << instruction->getDestination() << " " << instruction->getVectorOperation() << "= "
+           << instruction->getRight() << "[" << instruction->getCounter() << "]";
+    } else {
+        os << instruction->getDestination() << "[" << instruction->getCounter() << "] = "
+           << instruction->getLeft() << "[" << instruction->getCounter() << "] "
+           << instruction->getVectorOperation() << " " << instruction->getRight();
+        if (!instruction->isRightConstant()) {
+            os << "[" << instruction->getCounter() << "]";
+        }
+    }
+}
+
+void PdfIRVisitor::visitJumpTable(JumpTableInstruction *instruction, std::ostream &os) {
+    os << "jump table: "
+       << instruction->getTableLabel() << "[" << instruction->getValue() << " - " << instruction->getMinimum() << "], "
+       << instruction->getTargets().size() << " entries, "
+       << "default=" << instruction->getDefaultTarget()->getLabelName();
+}
+
+void PdfIRVisitor::visitArrayInit(ArrayInitInstruction *instruction, std::ostream &os) {
+    os << "array init: "
+       << instruction->getArrayName() << "[" << instruction->getLength() << "] = "
+       << instruction->getBlobLabel() << "[" << instruction->getValues().size() << "], "
+       << "zero-filled tail";
+}
+
 } // namespace caramel::ir::Pdf
@@ -92,6 +92,12 @@ public:
     void visitBitwiseOr(BitwiseOrInstruction *instruction, std::ostream &os) override;
 
     void visitBitwiseXor(BitwiseXorInstruction *instruction, std::ostream &os) override;
+
+    void visitVectorLoop(VectorLoopInstruction *instruction, std::ostream &os) override;
+
+    void visitJumpTable(JumpTableInstruction *instruction, std::ostream &os) override;
+
+    void visitArrayInit(ArrayInitInstruction *instruction, std::ostream &os) override;
 };
 
 } // namespace caramel::ir::Pdf
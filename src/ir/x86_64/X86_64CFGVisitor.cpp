@@ -24,49 +24,78 @@
 
 #include "X86_64CFGVisitor.h"
 #include "X86_64BasicBlockVisitor.h"
+#include "X86_64IRVisitor.h"
+#include "../../utils/Parallel.h"
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <vector>
 
 namespace caramel::ir::x86_64 {
+
+using namespace caramel::utils;
+
 X86_64CFGVisitor::X86_64CFGVisitor():
     mBasicBlockVisitor{new X86_64BasicBlockVisitor} {}
 
+/**
+ * Appends the basic blocks reachable from bb in post-order, which is the reverse of the emission order.
+ */
+static void orderBasicBlocks(
+        ir::BasicBlock::Ptr const &bb,
+        std::set<size_t> &visited,
+        std::vector<ir::BasicBlock::Ptr> &order
+) {
+    if (!visited.insert(bb->getId()).second) {
+        return;
+    }
+
+    if (bb->getNextWhenFalse()) {
+        orderBasicBlocks(bb->getNextWhenFalse(), visited, order);
+    }
+    if (bb->getNextWhenTrue()) {
+        orderBasicBlocks(bb->getNextWhenTrue(), visited, order);
+    }
+    auto const &jumpTargets = bb->getJumpTargets();
+    for (auto it = jumpTargets.rbegin(), end_it = jumpTargets.rend(); it != end_it; ++it) {
+        orderBasicBlocks(*it, visited, order);
+    }
+
+    order.push_back(bb);
+}
+
+static std::vector<ir::BasicBlock::Ptr> orderFunction(ir::BasicBlock::Ptr const &functionRoot) {
+    std::set<size_t> visited;
+    std::vector<ir::BasicBlock::Ptr> order;
+    orderBasicBlocks(functionRoot, visited, order);
+    return order;
+}
+
 void X86_64CFGVisitor::generateAssembly(std::shared_ptr<ir::CFG> const &controlFlowGraph, std::ostream &os) {
 
     generateAssemblyPrologue(controlFlowGraph, os);
     os << std::endl;
 
-    for (auto const &function_root_bb : controlFlowGraph->getBasicBlocks()) {
-        generateAssembly(controlFlowGraph, os, function_root_bb->getId(), function_root_bb);
-
-        auto &order = mOrders[function_root_bb->getId()];
+    // Functions are independent: emit each one into its own buffer, then concatenate them in source order
+    auto const &functions = controlFlowGraph->getBasicBlocks();
+    std::vector<std::string> outputs(functions.size());
+    parallelFor(functions.size(), controlFlowGraph->getConfig().jobs, [&](size_t i) {
+        std::stringstream functionOS;
+        auto const order = orderFunction(functions[i]);
         for (auto it = order.rbegin(), end_it = order.rend(); it != end_it; ++it) {
-            mBasicBlockVisitor->generateAssembly(*it, os);
+            mBasicBlockVisitor->generateAssembly(*it, functionOS);
         }
+        outputs[i] = functionOS.str();
+    });
+    for (auto const &output : outputs) {
+        os << output;
     }
 
     os << std::endl;
     generateAssemblyEpilogue(controlFlowGraph, os);
 }
 
-void X86_64CFGVisitor::generateAssembly(
-        std::shared_ptr<ir::CFG> const &controlFlowGraph,
-        std::ostream &os,
-        size_t functionRootId,
-        ir::BasicBlock::Ptr bb) {
-    if (mVisitedBB.find(bb->getId()) != mVisitedBB.end()) {
-        return;
-    }
-    mVisitedBB.insert(bb->getId());
-
-    if (bb->getNextWhenFalse()) {
-        generateAssembly(controlFlowGraph, os, functionRootId , bb->getNextWhenFalse());
-    }
-    if (bb->getNextWhenTrue()) {
-        generateAssembly(controlFlowGraph, os, functionRootId , bb->getNextWhenTrue());
-    }
-
-    mOrders[functionRootId].push_back(bb);
-}
-
 void X86_64CFGVisitor::generateAssemblyPrologue(
         std::shared_ptr<ir::CFG> const &controlFlowGraph,
         std::ostream &os
@@ -83,10 +112,38 @@ void X86_64CFGVisitor::generateAssemblyEpilogue(
         std::shared_ptr<ir::CFG> const &controlFlowGraph,
         std::ostream &os
 ) {
-    CARAMEL_UNUSED(controlFlowGraph);
-    CARAMEL_UNUSED(os);
+    auto const &globals = controlFlowGraph->getGlobalVariables();
+    if (globals.empty()) {
+        return;
+    }
 
-    // Strings
+    for (auto const &global : globals) {
+        size_t const bitSize = global.type->getMemoryLength();
+        size_t const byteSize = bitSize / 8U * global.length;
+        size_t const alignment = byteSize >= 16 ? 16 : bitSize / 8U;
+        bool const isZero = std::all_of(global.values.begin(), global.values.end(), [](long long value) {
+            return value == 0;
+        });
+
+        if (global.common) {
+            os << "  .comm " << global.name << ", " << byteSize << ", " << alignment << '\n';
+            continue;
+        }
+
+        // Every global is exported and may be written by another file, so none can go into .rodata
+        if (isZero) {
+            os << "  .bss" << '\n';
+        } else {
+            os << "  .data" << '\n';
+        }
+        os << "  .globl " << global.name << '\n'
+           << "  .align " << alignment << '\n'
+           << "  .type " << global.name << ", @object" << '\n'
+           << "  .size " << global.name << ", " << byteSize << '\n'
+           << global.name << ":" << '\n';
+
+        X86_64IRVisitor::writeData(os, global.values, bitSize, global.length);
+    }
 }
 
 } // namespace caramel::ir::x86_64
\ No newline at end of file
@@ -28,8 +28,6 @@
 #include "../CFGVisitor.h"
 #include "../BasicBlock.h"
 
-#include <map>
-#include <set>
 #include <memory>
 #include <ostream>
 
@@ -49,12 +47,6 @@ public:
 
     void generateAssembly(std::shared_ptr<ir::CFG> const &controlFlowGraph, std::ostream &os);
 
-    void generateAssembly(
-            std::shared_ptr<ir::CFG> const &controlFlowGraph,
-            std::ostream &os,
-            size_t functionRootId,
-            ir::BasicBlock::Ptr bb);
-
     void generateAssemblyPrologue(
             std::shared_ptr<ir::CFG> const &controlFlowGraph,
             std::ostream &os
@@ -66,9 +58,10 @@ public:
     );
 
 private:
+    /**
+     * stateless, so it is shared by the threads emitting the functions
+     */
     std::shared_ptr<X86_64BasicBlockVisitor> mBasicBlockVisitor;
-    std::map<size_t, std::vector<ir::BasicBlock::Ptr>> mOrders;
-    std::set<size_t> mVisitedBB;
 };
 
 } // namespace caramel::ir::x86_64
@@ -48,6 +48,9 @@
 #include "../instructions/BitwiseAndInstruction.h"
 #include "../instructions/BitwiseOrInstruction.h"
 #include "../instructions/BitwiseXorInstruction.h"
+#include "../instructions/VectorLoopInstruction.h"
+#include "../instructions/JumpTableInstruction.h"
+#include "../instructions/ArrayInitInstruction.h"
 
 #define COMMENT_INDENT "                 "
 
@@ -61,7 +64,7 @@ std::string X86_64IRVisitor::address(std::string const &symbol) {
 }
 
 std::string X86_64IRVisitor::toAssembly(ir::BasicBlock::Ptr parentBB, std::string const &anySymbol, size_t bitSize) {
-    logger.trace() << "[x86_64] " << "toAssembly(" << "ir" << ", " << anySymbol << ")";
+    CARAMEL_TRACE << "[x86_64] " << "toAssembly(" << "ir" << ", " << anySymbol << ")";
     std::string r;
 
 //     return anySymbol;
@@ -73,16 +76,21 @@ std::string X86_64IRVisitor::toAssembly(ir::BasicBlock::Ptr parentBB, std::strin
     } else if (!anySymbol.empty() && anySymbol[0] == '!' && false) {
         r = regToAsm(IR::REGISTER_10, bitSize);
         // TODO: Manage multiple registries
-    } else if (!anySymbol.empty() && anySymbol[0] >= '0' && anySymbol[0] <= '9') {
-        r = "$" + anySymbol;
+        // Is already a memory operand, like the -8(%rbp,%rax,4) of an array access
     } else if (!anySymbol.empty() && anySymbol.back() == ')') {
         r = anySymbol;
+    } else if (!anySymbol.empty() && anySymbol[0] >= '0' && anySymbol[0] <= '9') {
+        r = "$" + anySymbol;
+    } else if (anySymbol.size() > 1 && anySymbol[0] == '-' && anySymbol[1] >= '0' && anySymbol[1] <= '9') {
+        r = "$" + anySymbol;
+    } else if (parentBB->isSymbolGlobal(anySymbol)) {
+        r = anySymbol + address(regToAsm(IR::INSTRUCTION_POINTER_REG, 64));
     } else {
         r = std::to_string(parentBB->getSymbolIndex(anySymbol)) +
             address(regToAsm(IR::BASE_POINTER_REG, 64)); // always %rbp
     }
 
-    logger.trace() << "[x86_64] " << "  => " << r;
+    CARAMEL_TRACE << "[x86_64] " << "  => " << r;
     return r;
 }
 
@@ -118,6 +126,7 @@ std::string X86_64IRVisitor::regToAsm(std::string register_, size_t bitSize) {
             {IR::DEST_REG,          {{16, "%di"},   {32, "%edi"},  {64, "%rdi"}}},
             {IR::BASE_POINTER_REG,  {{16, "%bp"},   {32, "%ebp"},  {64, "%rbp"}}},
             {IR::STACK_POINTER_REG, {{16, "%sp"},   {32, "%esp"},  {64, "%rsp"}}},
+            {IR::INSTRUCTION_POINTER_REG, {{64, "%rip"}}},
             {IR::ACCUMULATOR,       {{8,  "%al"},   {16, "%ax"},   {32, "%eax"},  {64, "%rax"}}},
             {IR::ACCUMULATOR_1,     {{8,  "%r10b"}, {16, "%r10w"}, {32, "%r10d"}, {64, "%r10"}}},
             {IR::ACCUMULATOR_2,     {{8,  "%r11b"}, {16, "%r11w"}, {32, "%r11d"}, {64, "%r11"}}},
@@ -138,6 +147,41 @@ std::string X86_64IRVisitor::regToAsm(std::string register_, size_t bitSize) {
     return REGISTERS.at(register_).at(bitSize);
 }
 
+void X86_64IRVisitor::writeData(std::ostream &os, std::vector<long long> const &values, size_t bitSize,
+                                size_t length) {
+    static std::map<size_t, std::string> const directives = {
+            {8, ".byte"},
+            {16, ".value"},
+            {32, ".long"},
+            {64, ".quad"}
+    };
+
+    // Only the values up to the last non-zero one are written, the rest is zero-filled
+    auto const truncate = [bitSize](long long value) -> long long {
+        switch (bitSize) {
+            case 8:
+                return static_cast<int8_t>(value);
+            case 16:
+                return static_cast<int16_t>(value);
+            case 32:
+                return static_cast<int32_t>(value);
+            default:
+                return value;
+        }
+    };
+    size_t nonZeroLength = values.size();
+    while (nonZeroLength > 0 && truncate(values[nonZeroLength - 1]) == 0) {
+        --nonZeroLength;
+    }
+
+    for (size_t i = 0; i < nonZeroLength; ++i) {
+        os << "  " << directives.at(bitSize) << " " << truncate(values[i]) << '\n';
+    }
+    if (nonZeroLength < length) {
+        os << "  .zero " << (length - nonZeroLength) * (bitSize / 8U) << '\n';
+    }
+}
+
 std::string X86_64IRVisitor::getFCReg(size_t index) {
     static std::map<size_t, std::string> const FC_REGISTERS = {
             {0, IR::DEST_REG},
@@ -157,7 +201,7 @@ std::string X86_64IRVisitor::getFCReg(size_t index) {
 }
 
 void X86_64IRVisitor::visitCopy(caramel::ir::CopyInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting copy: " << instruction->getReturnName();
+    CARAMEL_TRACE << "[x86_64] " << "visiting copy: " << instruction->getReturnName();
 
     auto parameterSize = instruction->getType()->getMemoryLength();
     if (instruction->getParentBlock()->hasSymbol(instruction->getDestination())
@@ -178,13 +222,13 @@ void X86_64IRVisitor::visitCopy(caramel::ir::CopyInstruction *instruction, std::
 }
 
 void X86_64IRVisitor::visitCopyAddr(CopyAddrInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting copy addr: " << instruction->getReturnName();
+    CARAMEL_TRACE << "[x86_64] " << "visiting copy addr: " << instruction->getReturnName();
 
     auto const bb = instruction->getParentBlock();
     auto const src = instruction->getSource();
     auto const dest = instruction->getDestination();
 
-    if (instruction->isLocalArray()) {
+    if (instruction->isLocalArray() || bb->isSymbolGlobal(src)) {
         os << "  leaq    " << toAssembly(bb, src, 64) << ", " << regToAsm(IR::ACCUMULATOR, 64);
         os << '\n';
         os << "  movq    " << regToAsm(IR::ACCUMULATOR, 64) << ", " << toAssembly(bb, dest, 64);
@@ -196,7 +240,7 @@ void X86_64IRVisitor::visitCopyAddr(CopyAddrInstruction *instruction, std::ostre
 }
 
 void X86_64IRVisitor::visitArrayAccess(ArrayAccessInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting array access: " << instruction->getReturnName();
+    CARAMEL_TRACE << "[x86_64] " << "visiting array access: " << instruction->getReturnName();
 
     os << "  # common begin of arrayAccess of " << instruction->getArrayName() << '\n';
     os << "  pushq " << toAssembly(instruction->getParentBlock(), IR::DATA_REG, 64);
@@ -209,25 +253,26 @@ void X86_64IRVisitor::visitArrayAccess(ArrayAccessInstruction *instruction, std:
 //        logger.warning() << "[x86_64] ArrayAccess with other-than-32-bit index.";
 //    }
 
-    // Copy the index to ACCUMULATOR
+    // Copy the index to ACCUMULATOR, with the size of the index and not of the elements
+    auto const indexLength = instruction->getIndexType()->getMemoryLength();
     writeMove(instruction->getParentBlock(), os,
-              index, length,
-              IR::ACCUMULATOR, length);
+              index, indexLength,
+              IR::ACCUMULATOR, indexLength);
     os << '\n';
-    if (instruction->getIndexType()->getMemoryLength() < 64) {
-        auto const indexLength = instruction->getIndexType()->getMemoryLength();
+    if (indexLength < 64) {
         if (indexLength == 32) {
             os << "  cltq";
         } else if (indexLength == 16) {
-            os << "  cwtq";
+            os << "  movswq  %ax, %rax";
         } else { // 8-bit
-            os << "  cbtq";
+            os << "  movsbq  %al, %rax";
         }
         os << '\n';
     }
 
     bool arrayIsPtr = instruction->getParentBlock()->isSymbolParamArray(instruction->getArrayName());
-    if (!arrayIsPtr) {
+    bool arrayIsGlobal = instruction->getParentBlock()->isSymbolGlobal(instruction->getArrayName());
+    if (!arrayIsPtr && !arrayIsGlobal) {
         os << "  # begin of local arrayAccess of " << instruction->getArrayName() << '\n';
 
         // The src/dest format for local array access
@@ -257,7 +302,7 @@ void X86_64IRVisitor::visitArrayAccess(ArrayAccessInstruction *instruction, std:
         }
         os << "\n  # end of local arrayAccess of " << instruction->getArrayName();
 
-    } else { // Array as argument == pointer
+    } else { // Array as argument == pointer, or global array
         os << "  # begin of remote arrayAccess of " << instruction->getArrayName() << '\n';
 
         // Compute the offset into DATA_REG
@@ -266,9 +311,14 @@ void X86_64IRVisitor::visitArrayAccess(ArrayAccessInstruction *instruction, std:
         os << '\n';
 
         // Copy the array base address to ACCUMULATOR
-        writeMove(instruction->getParentBlock(), os,
-                  instruction->getArrayName(), 64,
-                  IR::ACCUMULATOR, 64);
+        if (arrayIsGlobal) {
+            os << "  leaq    " << toAssembly(instruction->getParentBlock(), instruction->getArrayName(), 64)
+               << ", " << regToAsm(IR::ACCUMULATOR, 64);
+        } else {
+            writeMove(instruction->getParentBlock(), os,
+                      instruction->getArrayName(), 64,
+                      IR::ACCUMULATOR, 64);
+        }
         os << '\n';
 
         // Add the offset to the base address => ACCUMULATOR
@@ -307,13 +357,13 @@ void X86_64IRVisitor::visitArrayAccess(ArrayAccessInstruction *instruction, std:
 }
 
 void X86_64IRVisitor::visitEmpty(caramel::ir::EmptyInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting empty";
+    CARAMEL_TRACE << "[x86_64] " << "visiting empty";
 
     os << "  # empty with returnName=" << instruction->getReturnName();
 }
 
 void X86_64IRVisitor::visitProlog(caramel::ir::PrologInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting prolog: " << instruction->getReturnName();
+    CARAMEL_TRACE << "[x86_64] " << "visiting prolog: " << instruction->getReturnName();
     os << "  pushq   %rbp" << '\n'
        << "  movq    %rsp, %rbp" << '\n';
 
@@ -325,7 +375,7 @@ void X86_64IRVisitor::visitProlog(caramel::ir::PrologInstruction *instruction, s
 }
 
 void X86_64IRVisitor::visitEpilog(caramel::ir::EpilogInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting epilog";
+    CARAMEL_TRACE << "[x86_64] " << "visiting epilog";
 
     CARAMEL_UNUSED(instruction);
 //    os << "  popq    %rbp" << std::endl; // leave restore %rsp for us
@@ -334,7 +384,7 @@ void X86_64IRVisitor::visitEpilog(caramel::ir::EpilogInstruction *instruction, s
 }
 
 void X86_64IRVisitor::visitMod(caramel::ir::ModInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting modulo: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting modulo: "
                    << instruction->getLeft() << " % " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -361,7 +411,7 @@ void X86_64IRVisitor::visitMod(caramel::ir::ModInstruction *instruction, std::os
 }
 
 void X86_64IRVisitor::visitDivision(caramel::ir::DivInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting division: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting division: "
                    << instruction->getLeft() << " / " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -381,7 +431,7 @@ void X86_64IRVisitor::visitDivision(caramel::ir::DivInstruction *instruction, st
 }
 
 void X86_64IRVisitor::visitAddition(caramel::ir::AdditionInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting addition: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting addition: "
                    << instruction->getLeft() << " + " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -402,7 +452,7 @@ void X86_64IRVisitor::visitAddition(caramel::ir::AdditionInstruction *instructio
 }
 
 void X86_64IRVisitor::visitLdConst(caramel::ir::LDConstInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting ldconst: " << instruction->getDestination() << " = "
+    CARAMEL_TRACE << "[x86_64] " << "visiting ldconst: " << instruction->getDestination() << " = "
                    << instruction->getValue();
 
     writeMove(instruction->getParentBlock(), os,
@@ -411,14 +461,14 @@ void X86_64IRVisitor::visitLdConst(caramel::ir::LDConstInstruction *instruction,
 }
 
 void X86_64IRVisitor::visitNope(caramel::ir::NopInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting nop";
+    CARAMEL_TRACE << "[x86_64] " << "visiting nop";
 
     CARAMEL_UNUSED(instruction);
     os << "  nop";
 }
 
 void X86_64IRVisitor::visitFunctionCall(caramel::ir::FunctionCallInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting functionCall: " << instruction->getFunctionName();
+    CARAMEL_TRACE << "[x86_64] " << "visiting functionCall: " << instruction->getFunctionName();
 
     if (instruction->isVariadic()) {
         // https://stackoverflow.com/questions/6212665/why-is-eax-zeroed-before-a-call-to-printf#6212835
@@ -447,13 +497,13 @@ void X86_64IRVisitor::visitFunctionCall(caramel::ir::FunctionCallInstruction *in
 }
 
 void X86_64IRVisitor::visitBreak(caramel::ir::BreakInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting break: " << instruction->getReturnName();
+    CARAMEL_TRACE << "[x86_64] " << "visiting break: " << instruction->getReturnName();
 
      os << "  jmp    " << instruction->getDestBBLabel();
 }
 
 void X86_64IRVisitor::visitReturn(caramel::ir::ReturnInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting return: " << instruction->getReturnName();
+    CARAMEL_TRACE << "[x86_64] " << "visiting return: " << instruction->getReturnName();
 
     const auto returnSize = instruction->getType()->getMemoryLength();
     if (returnSize > 0) {
@@ -468,7 +518,7 @@ void X86_64IRVisitor::visitReturn(caramel::ir::ReturnInstruction *instruction, s
 }
 
 void X86_64IRVisitor::visitCallParameter(CallParameterInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting call parameter: " << instruction->getValue();
+    CARAMEL_TRACE << "[x86_64] " << "visiting call parameter: " << instruction->getValue();
 
     auto index = size_t(instruction->getIndex());
     if (index < 6) {
@@ -493,7 +543,7 @@ void X86_64IRVisitor::visitCallParameter(CallParameterInstruction *instruction,
 }
 
 void X86_64IRVisitor::visitSubtraction(SubtractionInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting subtraction: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting subtraction: "
                    << instruction->getLeft() << " - " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -514,7 +564,7 @@ void X86_64IRVisitor::visitSubtraction(SubtractionInstruction *instruction, std:
 }
 
 void X86_64IRVisitor::visitPush(PushInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting push: " << instruction->getSource();
+    CARAMEL_TRACE << "[x86_64] " << "visiting push: " << instruction->getSource();
 
 //    size_t typeSize = instruction->getType()->getMemoryLength();
 
@@ -530,7 +580,7 @@ void X86_64IRVisitor::visitPush(PushInstruction *instruction, std::ostream &os)
 }
 
 void X86_64IRVisitor::visitPop(PopInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting push: " << instruction->getDestination();
+    CARAMEL_TRACE << "[x86_64] " << "visiting push: " << instruction->getDestination();
 
 //    size_t typeSize = instruction->getType()->getMemoryLength();
 
@@ -546,7 +596,7 @@ void X86_64IRVisitor::visitPop(PopInstruction *instruction, std::ostream &os) {
 }
 
 void X86_64IRVisitor::visitMultiplication(MultiplicationInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting multiplication: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting multiplication: "
                    << instruction->getLeft() << " * " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -568,7 +618,7 @@ void X86_64IRVisitor::visitMultiplication(MultiplicationInstruction *instruction
 }
 
 void X86_64IRVisitor::visitFlagToReg(FlagToRegInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting flag to reg: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting flag to reg: "
                    << instruction->getLeft() << " - " << instruction->getRight();
 
 //    const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -592,7 +642,7 @@ void X86_64IRVisitor::visitFlagToReg(FlagToRegInstruction *instruction, std::ost
 }
 
 void X86_64IRVisitor::visitLeftShift(LeftShiftInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting left shift: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting left shift: "
                    << instruction->getLeft() << " << " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -608,7 +658,7 @@ void X86_64IRVisitor::visitLeftShift(LeftShiftInstruction *instruction, std::ost
 }
 
 void X86_64IRVisitor::visitRightShift(RightShiftInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting right shift: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting right shift: "
                    << instruction->getLeft() << " >> " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -625,7 +675,7 @@ void X86_64IRVisitor::visitRightShift(RightShiftInstruction *instruction, std::o
 }
 
 void X86_64IRVisitor::visitBitwiseAnd(BitwiseAndInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting bitwise and: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting bitwise and: "
                    << instruction->getLeft() << " & " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -647,7 +697,7 @@ void X86_64IRVisitor::visitBitwiseAnd(BitwiseAndInstruction *instruction, std::o
 }
 
 void X86_64IRVisitor::visitBitwiseOr(BitwiseOrInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting bitwise or: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting bitwise or: "
                    << instruction->getLeft() << " | " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -669,7 +719,7 @@ void X86_64IRVisitor::visitBitwiseOr(BitwiseOrInstruction *instruction, std::ost
 }
 
 void X86_64IRVisitor::visitBitwiseXor(BitwiseXorInstruction *instruction, std::ostream &os) {
-    logger.trace() << "[x86_64] " << "visiting bitwise xor: "
+    CARAMEL_TRACE << "[x86_64] " << "visiting bitwise xor: "
                    << instruction->getLeft() << " ^ " << instruction->getRight();
 
     const auto parameterSize = instruction->getType()->getMemoryLength();
@@ -691,11 +741,189 @@ void X86_64IRVisitor::visitBitwiseXor(BitwiseXorInstruction *instruction, std::o
               instruction->getReturnName(), parameterSize);
 }
 
+void X86_64IRVisitor::visitVectorLoop(VectorLoopInstruction *instruction, std::ostream &os) {
+    CARAMEL_TRACE << "[x86_64] " << "visiting vector loop: " << instruction->getCounter()
+                   << " in [" << instruction->getBegin() << ", " << instruction->getEnd() << "[";
+
+    auto const bb = instruction->getParentBlock();
+    bool const avx2 = instruction->getLanes() == 8;
+    std::string const vec0 = avx2 ? "%ymm0" : "%xmm0";
+    std::string const vec1 = avx2 ? "%ymm1" : "%xmm1";
+    std::string const v = avx2 ? "v" : "";
+
+    auto const elementMemAsm = [&](std::string const &array) {
+        // => -32(%rbp,%rax,4)
+        std::string arrayMemAsm = toAssembly(bb, array, 32);
+        arrayMemAsm.pop_back();
+        return arrayMemAsm + ',' + regToAsm(IR::ACCUMULATOR, 64) + ",4)";
+    };
+    auto const writeVectorOp = [&](std::string const &op, std::string const &src, std::string const &dest) {
+        os << "  " << v << op << "   " << src << ", ";
+        if (avx2) {
+            os << dest << ", ";
+        }
+        os << dest << '\n';
+    };
+
+    std::string op;
+    switch (instruction->getVectorOperation()) {
+        case VectorOperation::Add: op = "paddd"; break;
+        case VectorOperation::Sub: op = "psubd"; break;
+        case VectorOperation::And: op = "pand"; break;
+        case VectorOperation::Or: op = "por"; break;
+        case VectorOperation::Xor: op = "pxor"; break;
+    }
+
+    os << "  # begin of vectorized loop on " << instruction->getCounter()
+       << " (" << (avx2 ? "avx2" : "sse2") << ")" << '\n';
+
+    if (instruction->isReduction()) {
+        if (instruction->getVectorOperation() == VectorOperation::And) {
+            writeVectorOp("pcmpeqd", vec0, vec0);
+        } else {
+            writeVectorOp("pxor", vec0, vec0);
+        }
+    } else if (instruction->isRightConstant()) {
+        os << "  movl    $" << instruction->getRight() << ", " << regToAsm(IR::COUNTER_REG, 32) << '\n';
+        os << "  " << v << "movd    " << regToAsm(IR::COUNTER_REG, 32) << ", %xmm1" << '\n';
+        if (avx2) {
+            os << "  vpbroadcastd    %xmm1, %ymm1" << '\n';
+        } else {
+            os << "  pshufd  $0, %xmm1, %xmm1" << '\n';
+        }
+    }
+    os << "  movq    $" << instruction->getBegin() << ", " << regToAsm(IR::ACCUMULATOR, 64) << '\n';
+
+    os << instruction->getLabel() << ":" << '\n';
+    if (instruction->isReduction()) {
+        os << "  " << v << "movdqu  " << elementMemAsm(instruction->getRight()) << ", " << vec1 << '\n';
+        writeVectorOp(op, vec1, vec0);
+    } else {
+        os << "  " << v << "movdqu  " << elementMemAsm(instruction->getLeft()) << ", " << vec0 << '\n';
+        if (!instruction->isRightConstant()) {
+            os << "  " << v << "movdqu  " << elementMemAsm(instruction->getRight()) << ", " << vec1 << '\n';
+        }
+        writeVectorOp(op, vec1, vec0);
+        os << "  " << v << "movdqu  " << vec0 << ", " << elementMemAsm(instruction->getDestination()) << '\n';
+    }
+    os << "  addq    $" << instruction->getLanes() << ", " << regToAsm(IR::ACCUMULATOR, 64) << '\n';
+    os << "  cmpq    $" << instruction->getEnd() << ", " << regToAsm(IR::ACCUMULATOR, 64) << '\n';
+    os << "  jl      " << instruction->getLabel() << '\n';
+
+    if (instruction->isReduction()) {
+        // Horizontal reduction of the lanes into the low one
+        std::string const combineOp = instruction->getVectorOperation() == VectorOperation::Sub ? "paddd" : op;
+        if (avx2) {
+            os << "  vextracti128    $1, %ymm0, %xmm1" << '\n';
+            writeVectorOp(combineOp, "%xmm1", "%xmm0");
+        }
+        os << "  " << v << "pshufd  $0x4e, %xmm0, %xmm1" << '\n';
+        writeVectorOp(combineOp, "%xmm1", "%xmm0");
+        os << "  " << v << "pshufd  $0xb1, %xmm0, %xmm1" << '\n';
+        writeVectorOp(combineOp, "%xmm1", "%xmm0");
+        os << "  " << v << "movd    %xmm0, " << regToAsm(IR::COUNTER_REG, 32) << '\n';
+
+        std::string scalarOp;
+        switch (instruction->getVectorOperation()) {
+            case VectorOperation::Add:
+            case VectorOperation::Sub: scalarOp = "addl"; break;
+            case VectorOperation::And: scalarOp = "andl"; break;
+            case VectorOperation::Or: scalarOp = "orl"; break;
+            case VectorOperation::Xor: scalarOp = "xorl"; break;
+        }
+        os << "  " << scalarOp << "    " << regToAsm(IR::COUNTER_REG, 32) << ", "
+           << toAssembly(bb, instruction->getDestination(), 32) << '\n';
+    }
+    if (avx2) {
+        os << "  vzeroupper" << '\n';
+    }
+
+    auto const counterSize = instruction->getType()->getMemoryLength();
+    writeMove(bb, os,
+              std::to_string(instruction->getEnd()), counterSize,
+              instruction->getCounter(), counterSize);
+    os << "\n  # end of vectorized loop on " << instruction->getCounter();
+}
+
+void X86_64IRVisitor::visitJumpTable(JumpTableInstruction *instruction, std::ostream &os) {
+    CARAMEL_TRACE << "[x86_64] " << "visiting jump table: " << instruction->getTableLabel()
+                   << "[" << instruction->getValue() << "]";
+
+    static std::map<size_t, std::string> const signExtendInstr = {
+            {8, "movsbq"},
+            {16, "movswq"},
+            {32, "movslq"},
+            {64, "movq"}
+    };
+
+    auto const bb = instruction->getParentBlock();
+    auto const valueSize = instruction->getType()->getMemoryLength();
+    std::string const accumulator = regToAsm(IR::ACCUMULATOR, 64);
+
+    os << "  " << signExtendInstr.at(valueSize) << "  "
+       << toAssembly(bb, instruction->getValue(), valueSize) << ", " << accumulator << '\n';
+    if (instruction->getMinimum() != 0) {
+        os << "  subq    $" << instruction->getMinimum() << ", " << accumulator << '\n';
+    }
+    os << "  cmpq    $" << instruction->getTargets().size() - 1 << ", " << accumulator << '\n';
+    os << "  ja      " << instruction->getDefaultTarget()->getLabelName() << '\n';
+    os << "  jmp     *" << instruction->getTableLabel() << "(," << accumulator << ",8)" << '\n';
+
+    os << "  .section .rodata" << '\n'
+       << "  .align 8" << '\n'
+       << instruction->getTableLabel() << ":" << '\n';
+    for (auto const &target : instruction->getTargets()) {
+        os << "  .quad   " << target->getLabelName() << '\n';
+    }
+    os << "  .text";
+}
+
+void X86_64IRVisitor::visitArrayInit(ArrayInitInstruction *instruction, std::ostream &os) {
+    CARAMEL_TRACE << "[x86_64] " << "visiting array init: " << instruction->getArrayName();
+
+    auto const bb = instruction->getParentBlock();
+    auto const elementSize = instruction->getType()->getMemoryLength() / 8U;
+    auto const &values = instruction->getValues();
+
+    size_t const copyBytes = values.size() * elementSize;
+    size_t const zeroBytes = (instruction->getLength() - values.size()) * elementSize;
+    auto const writeRep = [&](std::string const &operation, size_t bytes) {
+        if (bytes / 8U > 0) {
+            os << "  movl    $" << bytes / 8U << ", " << regToAsm(IR::COUNTER_REG, 32) << '\n'
+               << "  rep " << operation << "q" << '\n';
+        }
+        if (bytes % 8U > 0) {
+            os << "  movl    $" << bytes % 8U << ", " << regToAsm(IR::COUNTER_REG, 32) << '\n'
+               << "  rep " << operation << "b" << '\n';
+        }
+    };
+
+    os << "  # bulk init of " << instruction->getArrayName() << '\n';
+    os << "  leaq    " << toAssembly(bb, instruction->getArrayName(), 64) << ", " << regToAsm(IR::DEST_REG, 64) << '\n';
+    if (copyBytes > 0) {
+        os << "  leaq    " << instruction->getBlobLabel() << address(regToAsm(IR::INSTRUCTION_POINTER_REG, 64))
+           << ", " << regToAsm(IR::SOURCE_REG, 64) << '\n';
+        writeRep("movs", copyBytes);
+    }
+    if (zeroBytes > 0) {
+        os << "  xorl    " << regToAsm(IR::ACCUMULATOR, 32) << ", " << regToAsm(IR::ACCUMULATOR, 32) << '\n';
+        writeRep("stos", zeroBytes);
+    }
+
+    if (copyBytes > 0) {
+        os << "  .section .rodata" << '\n'
+           << "  .align 8" << '\n'
+           << instruction->getBlobLabel() << ":" << '\n';
+        writeData(os, values, elementSize * 8U, values.size());
+        os << "  .text";
+    }
+}
+
 std::tuple<size_t, std::string, std::string>
 X86_64IRVisitor::prepareInstr(BasicBlock::Ptr const &bb, std::ostream &os,
                               std::string src, size_t srcSize,
                               std::string dest, size_t destSize) {
-    logger.trace() << "[x86_64] " << "preparing instruction...";
+    CARAMEL_TRACE << "[x86_64] " << "preparing instruction...";
 
     auto const maxSize = std::max(srcSize, destSize);
 
@@ -727,7 +955,7 @@ X86_64IRVisitor::prepareInstr(BasicBlock::Ptr const &bb, std::ostream &os,
 void X86_64IRVisitor::writeMove(BasicBlock::Ptr const &bb, std::ostream &os,
                                 std::string src, size_t srcSize,
                                 std::string dest, size_t destSize) {
-    logger.trace() << "[x86_64] " << "writing mov: src=" << src<< "(size=" << srcSize << ")"
+    CARAMEL_TRACE << "[x86_64] " << "writing mov: src=" << src<< "(size=" << srcSize << ")"
                    << ", dest=" << dest<< "(size=" << destSize << ")";
 
     static std::map<size_t, std::string> const movInstr = {
@@ -744,7 +972,7 @@ void X86_64IRVisitor::writeMove(BasicBlock::Ptr const &bb, std::ostream &os,
 void X86_64IRVisitor::writeCmp(BasicBlock::Ptr const &bb, std::ostream &os,
                                 std::string src, size_t srcSize,
                                 std::string dest, size_t destSize) {
-    logger.trace() << "[x86_64] " << "writing cmp: src=" << src<< "(size=" << srcSize << ")"
+    CARAMEL_TRACE << "[x86_64] " << "writing cmp: src=" << src<< "(size=" << srcSize << ")"
                    << ", dest=" << dest<< "(size=" << destSize << ")";
 
     auto [maxSize, srcAsm, destAsm] = prepareInstr(bb, os, src, srcSize, dest, destSize);
@@ -755,7 +983,7 @@ void X86_64IRVisitor::writeCmp(BasicBlock::Ptr const &bb, std::ostream &os,
 void X86_64IRVisitor::writeAdd(BasicBlock::Ptr const &bb, std::ostream &os,
                                 std::string src, size_t srcSize,
                                 std::string dest, size_t destSize) {
-    logger.trace() << "[x86_64] " << "writing add: src=" << src<< "(size=" << srcSize << ")"
+    CARAMEL_TRACE << "[x86_64] " << "writing add: src=" << src<< "(size=" << srcSize << ")"
                    << ", dest=" << dest<< "(size=" << destSize << ")";
 
     static std::map<size_t, std::string> const addInstr = {
@@ -772,7 +1000,7 @@ void X86_64IRVisitor::writeAdd(BasicBlock::Ptr const &bb, std::ostream &os,
 void X86_64IRVisitor::writeSub(BasicBlock::Ptr const &bb, std::ostream &os,
                                 std::string src, size_t srcSize,
                                 std::string dest, size_t destSize) {
-    logger.trace() << "[x86_64] " << "writing sub: src=" << src<< "(size=" << srcSize << ")"
+    CARAMEL_TRACE << "[x86_64] " << "writing sub: src=" << src<< "(size=" << srcSize << ")"
                    << ", dest=" << dest<< "(size=" << destSize << ")";
 
     static std::map<size_t, std::string> const subInstr = {
@@ -94,6 +94,12 @@ public:
 
     void visitBitwiseXor(BitwiseXorInstruction *instruction, std::ostream &os) override;
 
+    void visitVectorLoop(VectorLoopInstruction *instruction, std::ostream &os) override;
+
+    void visitJumpTable(JumpTableInstruction *instruction, std::ostream &os) override;
+
+    void visitArrayInit(ArrayInitInstruction *instruction, std::ostream &os) override;
+
 private:
     std::tuple<size_t, std::string, std::string>
     prepareInstr(BasicBlock::Ptr const &bb, std::ostream &os,
@@ -127,6 +133,8 @@ public: // FIXME
     std::string getFCReg(size_t index);
 
     std::string regToAsm(std::string register_, size_t bitSize);
+
+    static void writeData(std::ostream &os, std::vector<long long> const &values, size_t bitSize, size_t length);
 };
 
 } // namespace caramel::ir::x86_64
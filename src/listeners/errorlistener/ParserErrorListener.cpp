@@ -24,12 +24,12 @@
 
 #include "ParserErrorListener.h"
 #include "Common.h"
-#include "../../Console.h"
 
 
 namespace caramel::listeners {
 
-ParserErrorListener::ParserErrorListener(const std::string &sourceFile) : mSourceStream(sourceFile) {}
+ParserErrorListener::ParserErrorListener(utils::Diagnostics::Ptr diagnostics)
+        : mDiagnostics(std::move(diagnostics)) {}
 
 void ParserErrorListener::syntaxError(
         caramel_unused antlr4::Recognizer *recognizer,
@@ -39,23 +39,12 @@ void ParserErrorListener::syntaxError(
         caramel_unused const std::string &msg,
         caramel_unused std::exception_ptr e
 ) {
+    // The recovery often reports the following tokens of the same line again
     if (line != mLastErrorLine) {
-        if (mLastErrorLine == static_cast<size_t>(-1)) {
-            mLastErrorLine = 0;
-        }
-        using namespace caramel::colors;
-        std::cerr << "Error at line " << line << ':' << charPositionInLine << std::endl;
-        std::string textLine = mSourceStream.getLine(line, mLastErrorLine, false);
-        std::cerr << red << textLine << reset << std::endl;
-        std::cerr.width(charPositionInLine + 2); // + 2 is for the "^ " length
-        std::cerr << "^ ";
-        std::cerr.width();
-        std::cerr << "Unexpected \"" << offendingSymbol->getText() << "\"" << std::endl;
+        mDiagnostics->syntaxError(line, charPositionInLine, offendingSymbol->getText());
     }
 
     mLastErrorLine = line;
-
-    exit(1);
 }
 
 void ParserErrorListener::reportAmbiguity(antlr4::Parser *recognizer, const antlr4::dfa::DFA &dfa, size_t startIndex,
@@ -24,16 +24,19 @@
 
 #pragma once
 
-#include "../../utils/SourceFileUtil.h"
+#include "../../utils/Diagnostics.h"
 
 #include <antlr4-runtime.h>
 
 namespace caramel::listeners {
 
+/**
+ * Collects the syntax errors into the diagnostics, at most one per line, and lets the parser recover.
+ */
 class ParserErrorListener : public antlr4::BaseErrorListener {
 
 public:
-    explicit ParserErrorListener(const std::string &sourceFile);
+    explicit ParserErrorListener(utils::Diagnostics::Ptr diagnostics);
 
     ~ParserErrorListener() override = default;
 
@@ -54,7 +57,7 @@ private:
                                   size_t stopIndex, size_t prediction, antlr4::atn::ATNConfigSet *configs) override;
 
 private:
-    utils::SourceFileUtil mSourceStream;
+    utils::Diagnostics::Ptr mDiagnostics;
     size_t mLastErrorLine = static_cast<size_t>(-1);
 };
 
@@ -34,6 +34,7 @@
 #include "tclap.h"
 #include "ir/pdf/PdfCFGVisitor.h"
 #include "ir/x86_64/X86_64CFGVisitor.h"
+#include "utils/Arena.h"
 
 #include <iostream>
 
@@ -46,15 +47,25 @@ int main(int argc, const char *argv[]) {
     // Set the logger verbosity
     logger.setLevel(config.verbosity);
 
+    // The AST and IR nodes are owned by this arena until the end of the compilation
+    caramel::utils::Arena arena;
+    caramel::utils::ArenaScope arenaScope{arena};
+
     // Get the AST from the front-end
     caramel::ast::Context::Ptr astRoot{caramel::frontEnd(config)};
 
+    // Lower the AST once, every back-end output shares this CFG
+    caramel::ir::CFG::Ptr cfg;
+    if (config.irDot || config.compile) {
+        cfg = caramel::BackEnd::buildControlFlowGraph(config, astRoot);
+    }
+
     // Generate the IR pdf
     if (config.irDot) {
         std::stringstream irPdfSS;
         caramel::ir::CFGVisitor::Ptr irPdfArch = std::shared_ptr<caramel::ir::CFGVisitor>(
                 new caramel::ir::Pdf::PdfCFGVisitor);
-        caramel::BackEnd::generateAssembly(config.sourceFile, astRoot, irPdfSS, irPdfArch);
+        caramel::BackEnd::generateAssembly(cfg, irPdfSS, irPdfArch);
 
         std::ofstream irDotFile("ir.dot");
         irDotFile << irPdfSS.str();
@@ -70,7 +81,7 @@ int main(int argc, const char *argv[]) {
         std::stringstream assemblySS;
         caramel::ir::CFGVisitor::Ptr arch = std::shared_ptr<caramel::ir::CFGVisitor>(
                 new caramel::ir::x86_64::X86_64CFGVisitor);
-        caramel::BackEnd::generateAssembly(config.sourceFile, astRoot, assemblySS, arch);
+        caramel::BackEnd::generateAssembly(cfg, assemblySS, arch);
         std::string assembly = assemblySS.str();
 
         // Print the assembly on the standard output
@@ -97,6 +108,7 @@ int main(int argc, const char *argv[]) {
         }
     }
 
+    logger.debug() << "Allocated " << arena.getAllocatedSize() << " bytes of AST and IR nodes.";
     return EXIT_SUCCESS;
 }
 
@@ -117,6 +129,30 @@ Config parseArgs(int argc, const char *argv[]) {
         TCLAP::SwitchArg optimizeArg("O", "optimize", "Generate optimized code");
         cmd.add(optimizeArg);
 
+        // AVX2 target flag
+        TCLAP::SwitchArg avx2Arg("", "avx2", "Use AVX2 instead of SSE2 in vectorized loops");
+        cmd.add(avx2Arg);
+
+        // Loop unrolling factor
+        TCLAP::ValueArg<size_t> unrollArg("", "unroll", "Unroll factor of counted loops (1 disables unrolling)",
+                                          false, 0, "factor");
+        cmd.add(unrollArg);
+
+        // Number of threads of the back-end
+        TCLAP::ValueArg<size_t> jobsArg("j", "jobs", "Number of threads generating the functions (0 for one per core)",
+                                        false, 0, "jobs");
+        cmd.add(jobsArg);
+
+        // Parser
+        TCLAP::SwitchArg handwrittenParserArg("", "handwritten-parser",
+                                              "Parse with the hand-written front-end instead of ANTLR");
+        cmd.add(handwrittenParserArg);
+
+        // Diagnostics
+        TCLAP::ValueArg<size_t> errorLimitArg("", "error-limit", "Stop after this many errors (0 for no limit)",
+                                              false, 20, "count");
+        cmd.add(errorLimitArg);
+
         // Syntax tree - DOT export
         TCLAP::SwitchArg syntaxTreeDotArg("", "syntax-tree-dot", "Generate a DOT of the syntax tree");
         cmd.add(syntaxTreeDotArg);
@@ -157,8 +193,13 @@ Config parseArgs(int argc, const char *argv[]) {
         Config config{};
         config.staticAnalysis = staticAnalysisArg.getValue();
         config.optimize = optimizeArg.getValue();
+        config.targetAvx2 = avx2Arg.getValue();
+        config.unrollFactor = unrollArg.getValue();
+        config.jobs = jobsArg.getValue();
         config.compile = compileArg.getValue();
         config.assemble = assembleArg.getValue();
+        config.handwrittenParser = handwrittenParserArg.getValue();
+        config.errorLimit = errorLimitArg.getValue();
         config.syntaxTreeDot = syntaxTreeDotArg.getValue();
         config.astDot = astDotArg.getValue();
         config.irDot = irDotArg.getValue();
@@ -0,0 +1,239 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Lexer.h"
+
+#include <unordered_map>
+
+
+namespace caramel::parser {
+
+static const std::unordered_map<std::string_view, TokenType> KEYWORDS = {
+        {"typedef", TokenType::Typedef},
+        {"extern",  TokenType::Extern},
+        {"if",      TokenType::If},
+        {"else",    TokenType::Else},
+        {"while",   TokenType::While},
+        {"do",      TokenType::Do},
+        {"for",     TokenType::For},
+        {"return",  TokenType::Return},
+        {"break",   TokenType::Break}
+};
+
+// Sorted by decreasing length, so that the first match is the longest one
+static constexpr std::pair<char const *, TokenType> PUNCTUATION[] = {
+        {"<<=", TokenType::LeftShiftAssign},
+        {">>=", TokenType::RightShiftAssign},
+        {"+=",  TokenType::PlusAssign},
+        {"-=",  TokenType::MinusAssign},
+        {"*=",  TokenType::TimesAssign},
+        {"/=",  TokenType::DivAssign},
+        {"%=",  TokenType::ModAssign},
+        {"&=",  TokenType::BitwiseAndAssign},
+        {"|=",  TokenType::BitwiseOrAssign},
+        {"^=",  TokenType::BitwiseXorAssign},
+        {"~=",  TokenType::BitwiseNotAssign},
+        {"++",  TokenType::Increment},
+        {"--",  TokenType::Decrement},
+        {"<=",  TokenType::LowerEqThan},
+        {">=",  TokenType::GreaterEqThan},
+        {"==",  TokenType::Equality},
+        {"!=",  TokenType::Difference},
+        {"&&",  TokenType::And},
+        {"||",  TokenType::Or},
+        {"<<",  TokenType::LeftShift},
+        {">>",  TokenType::RightShift},
+        {"+",   TokenType::Plus},
+        {"-",   TokenType::Minus},
+        {"*",   TokenType::Times},
+        {"/",   TokenType::Div},
+        {"%",   TokenType::Mod},
+        {"<",   TokenType::LowerThan},
+        {">",   TokenType::GreaterThan},
+        {"=",   TokenType::Assignment},
+        {"!",   TokenType::LogicalNot},
+        {"~",   TokenType::BitwiseNot},
+        {"&",   TokenType::BitwiseAnd},
+        {"|",   TokenType::BitwiseOr},
+        {"^",   TokenType::BitwiseXor},
+        {"(",   TokenType::LeftPar},
+        {")",   TokenType::RightPar},
+        {"{",   TokenType::LeftCBracket},
+        {"}",   TokenType::RightCBracket},
+        {"[",   TokenType::LeftBracket},
+        {"]",   TokenType::RightBracket},
+        {",",   TokenType::Comma},
+        {";",   TokenType::Semicolon}
+};
+
+static bool isLetter(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+Lexer::Lexer(std::string_view source, antlr4::CharStream *charStream, utils::Diagnostics::Ptr diagnostics)
+        : mSource{source},
+          mCharStream{charStream},
+          mDiagnostics{std::move(diagnostics)},
+          mPosition{0},
+          mLine{1},
+          mColumn{0} {}
+
+std::deque<antlr4::CommonToken> Lexer::tokenize() {
+    std::deque<antlr4::CommonToken> tokens;
+
+    for (skipIgnored(); mPosition < mSource.length(); skipIgnored()) {
+        size_t const start = mPosition;
+        size_t const line = mLine;
+        size_t const column = mColumn;
+        char const c = mSource[mPosition];
+
+        std::optional<TokenType> type;
+        if (isLetter(c) || c == '_') {
+            // The grammar only allows a single leading underscore before the first letter
+            advance(1);
+            if (c != '_' || (mPosition < mSource.length() && isLetter(mSource[mPosition]))) {
+                while (mPosition < mSource.length()
+                       && (isLetter(mSource[mPosition]) || isDigit(mSource[mPosition]) || mSource[mPosition] == '_')) {
+                    advance(1);
+                }
+            }
+            auto keyword = KEYWORDS.find(mSource.substr(start, mPosition - start));
+            type = keyword == KEYWORDS.end() ? TokenType::Identifier : keyword->second;
+        } else if (isDigit(c)) {
+            while (mPosition < mSource.length() && isDigit(mSource[mPosition])) {
+                advance(1);
+            }
+            type = TokenType::Number;
+        } else if (c == '\'') {
+            type = lexCharacter();
+        } else {
+            type = lexPunctuation();
+        }
+
+        if (!type) {
+            recognitionError(start, line, column);
+            continue;
+        }
+
+        // The token has no text of its own, it reads it from the char stream on demand
+        antlr4::CommonToken &token = tokens.emplace_back(
+                std::make_pair(static_cast<antlr4::TokenSource *>(nullptr), mCharStream),
+                static_cast<size_t>(*type),
+                static_cast<size_t>(antlr4::Token::DEFAULT_CHANNEL),
+                start,
+                mPosition - 1
+        );
+        token.setLine(line);
+        token.setCharPositionInLine(column);
+        token.setTokenIndex(tokens.size() - 1);
+    }
+
+    antlr4::CommonToken &endOfFile = tokens.emplace_back(static_cast<size_t>(TokenType::EndOfFile), "<EOF>");
+    endOfFile.setLine(mLine);
+    endOfFile.setCharPositionInLine(mColumn);
+    endOfFile.setStartIndex(mPosition);
+    endOfFile.setStopIndex(mPosition - 1);
+    endOfFile.setTokenIndex(tokens.size() - 1);
+
+    return tokens;
+}
+
+void Lexer::skipIgnored() {
+    while (mPosition < mSource.length()) {
+        char const c = mSource[mPosition];
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            advance(1);
+        } else if (c == '#' || mSource.compare(mPosition, 2, "//") == 0) {
+            while (mPosition < mSource.length() && mSource[mPosition] != '\r' && mSource[mPosition] != '\n') {
+                advance(1);
+            }
+        } else if (mSource.compare(mPosition, 2, "/*") == 0) {
+            size_t end = mSource.find("*/", mPosition + 2);
+            if (end == std::string_view::npos) {
+                // Like the grammar, an unterminated comment is lexed as a division and a multiplication
+                return;
+            }
+            advance(end + 2 - mPosition);
+        } else {
+            return;
+        }
+    }
+}
+
+std::optional<TokenType> Lexer::lexCharacter() {
+    auto at = [this](size_t offset) {
+        return mPosition + offset < mSource.length() ? mSource[mPosition + offset] : '\0';
+    };
+
+    if (at(1) == '\\') {
+        // '\0', '\n', '\r', '\t', '\'', '\"' and '\\'
+        std::string const escaped{"0nrt'\"\\"};
+        if (escaped.find(at(2)) == std::string::npos || at(2) == '\0' || at(3) != '\'') {
+            return std::nullopt;
+        }
+        advance(4);
+    } else {
+        if (at(1) == '\'' || at(1) == '\r' || at(1) == '\n' || at(1) == '\0' || at(2) != '\'') {
+            return std::nullopt;
+        }
+        advance(3);
+    }
+    return TokenType::Character;
+}
+
+std::optional<TokenType> Lexer::lexPunctuation() {
+    for (auto const &[text, type] : PUNCTUATION) {
+        size_t const length = std::char_traits<char>::length(text);
+        if (mSource.compare(mPosition, length, text) == 0) {
+            advance(length);
+            return type;
+        }
+    }
+    return std::nullopt;
+}
+
+void Lexer::advance(size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (mSource[mPosition] == '\n') {
+            mLine++;
+            mColumn = 0;
+        } else {
+            mColumn++;
+        }
+        mPosition++;
+    }
+}
+
+void Lexer::recognitionError(size_t start, size_t line, size_t column) {
+    // Same recovery as the ANTLR lexer: report the character, skip it and go on
+    mPosition = start;
+    mDiagnostics->syntaxError(line, column, std::string{mSource.substr(start, 1)});
+    advance(1);
+}
+
+} // namespace caramel::parser
@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "../utils/Diagnostics.h"
+
+#include <CommonToken.h>
+
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace caramel::parser {
+
+enum class TokenType : size_t {
+    Identifier = 1,
+    Number,
+    Character,
+
+    // Keywords
+    Typedef,
+    Extern,
+    If,
+    Else,
+    While,
+    Do,
+    For,
+    Return,
+    Break,
+
+    // Punctuation
+    LeftPar,
+    RightPar,
+    LeftCBracket,
+    RightCBracket,
+    LeftBracket,
+    RightBracket,
+    Comma,
+    Semicolon,
+
+    // Operators
+    Plus,
+    Minus,
+    Times,
+    Div,
+    Mod,
+    Increment,
+    Decrement,
+    LogicalNot,
+    BitwiseNot,
+    LowerThan,
+    LowerEqThan,
+    GreaterThan,
+    GreaterEqThan,
+    Equality,
+    Difference,
+    BitwiseAnd,
+    BitwiseOr,
+    BitwiseXor,
+    And,
+    Or,
+    LeftShift,
+    RightShift,
+
+    // Assignment operators
+    Assignment,
+    PlusAssign,
+    MinusAssign,
+    TimesAssign,
+    DivAssign,
+    ModAssign,
+    BitwiseAndAssign,
+    BitwiseOrAssign,
+    BitwiseXorAssign,
+    BitwiseNotAssign,
+    LeftShiftAssign,
+    RightShiftAssign,
+
+    EndOfFile = antlr4::Token::EOF
+};
+
+/**
+ * Splits a Caramel source into tokens, skipping the whitespace, comments and macros like the grammar does.
+ * The tokens are ANTLR CommonTokens so that the AST nodes and the semantic errors can use them as is.
+ * They are spans into the source, their text is only read from the char stream when asked.
+ */
+class Lexer {
+public:
+    Lexer(std::string_view source, antlr4::CharStream *charStream, utils::Diagnostics::Ptr diagnostics);
+
+    /// Returns the tokens of the whole source, ended by an EndOfFile token. The unknown characters are reported and skipped.
+    std::deque<antlr4::CommonToken> tokenize();
+
+private:
+    void skipIgnored();
+    std::optional<TokenType> lexCharacter();
+    std::optional<TokenType> lexPunctuation();
+    void advance(size_t count);
+    void recognitionError(size_t start, size_t line, size_t column);
+
+private:
+    std::string_view mSource;
+    antlr4::CharStream *mCharStream;
+    utils::Diagnostics::Ptr mDiagnostics;
+
+    size_t mPosition;
+    size_t mLine;
+    size_t mColumn;
+};
+
+} // namespace caramel::parser
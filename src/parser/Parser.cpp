@@ -0,0 +1,1064 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Parser.h"
+#include "../Logger.h"
+#include "../utils/Common.h"
+#include "../utils/SourceFileUtil.h"
+#include "../visitors/ASTVisitor.h"
+#include "../ast/context/Prelude.h"
+#include "../ast/statements/controlblocks/IfBlock.h"
+#include "../ast/statements/controlblocks/ForBlock.h"
+#include "../ast/statements/controlblocks/WhileBlock.h"
+#include "../ast/statements/controlblocks/Do_WhileBlock.h"
+#include "../ast/statements/declaration/ArrayDeclaration.h"
+#include "../ast/statements/declaration/FunctionDeclaration.h"
+#include "../ast/statements/declaration/VariableDeclaration.h"
+#include "../ast/statements/definition/ArrayDefinition.h"
+#include "../ast/statements/definition/FunctionDefinition.h"
+#include "../ast/statements/definition/VariableDefinition.h"
+#include "../ast/statements/expressions/CommaExpression.h"
+#include "../ast/statements/expressions/atomicexpression/Constant.h"
+#include "../ast/statements/expressions/atomicexpression/Identifier.h"
+#include "../ast/statements/expressions/atomicexpression/ArrayAccess.h"
+#include "../ast/statements/expressions/atomicexpression/FunctionCall.h"
+#include "../ast/statements/expressions/binaryexpression/BinaryExpression.h"
+#include "../ast/statements/expressions/unaryexpression/UnaryExpression.h"
+#include "../ast/statements/jumps/BreakStatement.h"
+#include "../ast/statements/jumps/ReturnStatement.h"
+#include "../ast/operators/binaryoperators/BinaryOperatorIndex.h"
+#include "../ast/operators/prefixoperators/PrefixOperatorIndex.h"
+#include "../ast/operators/postfixoperators/PostfixOperatorIndex.h"
+#include "../exceptions/ArrayBlockSizeExceedsDeclarationException.h"
+
+#include <sstream>
+
+
+using namespace caramel::ast;
+using namespace caramel::utils;
+
+namespace caramel::parser {
+
+/// Pushes a new context on the parser stack for its lifetime, like visitors::ContextPusher does for the ASTVisitor.
+class Parser::ContextPusher {
+public:
+    explicit ContextPusher(Parser &parser) : mParser{parser} {
+        auto &contextStack = mParser.mContextStack;
+        if (not contextStack.empty()) {
+            contextStack.push(makeNode<Context>(contextStack.top()));
+        } else {
+            contextStack.push(makeNode<Context>());
+        }
+    }
+
+    ~ContextPusher() {
+        Context::Ptr context = mParser.mContextStack.top();
+        visitors::ContextPusher::verifUsageStatic(context);
+        logger.debug() << "Popped context: " << *context;
+        context->getSymbolTable()->exitScope();
+        mParser.mContextStack.pop();
+    }
+
+    Context::Ptr getContext() {
+        return mParser.currentContext();
+    }
+
+private:
+    Parser &mParser;
+};
+
+static constexpr size_t token(TokenType type) {
+    return static_cast<size_t>(type);
+}
+
+static constexpr size_t TOKEN_TYPES = token(TokenType::RightShiftAssign) + 1;
+
+static constexpr BinaryOperatorIndex<TOKEN_TYPES> BINARY_OPERATORS{
+        bindBinaryOperator<PlusOperator>(token(TokenType::Plus)),
+        bindBinaryOperator<MinusOperator>(token(TokenType::Minus)),
+        bindBinaryOperator<MultOperator>(token(TokenType::Times)),
+        bindBinaryOperator<DivOperator>(token(TokenType::Div)),
+        bindBinaryOperator<ModOperator>(token(TokenType::Mod)),
+        bindBinaryOperator<RightShiftOperator>(token(TokenType::RightShift)),
+        bindBinaryOperator<LeftShiftOperator>(token(TokenType::LeftShift)),
+        bindBinaryOperator<LowerThanOperator>(token(TokenType::LowerThan)),
+        bindBinaryOperator<LowerEqThanOperator>(token(TokenType::LowerEqThan)),
+        bindBinaryOperator<GreaterThanOperator>(token(TokenType::GreaterThan)),
+        bindBinaryOperator<GreaterEqThanOperator>(token(TokenType::GreaterEqThan)),
+        bindBinaryOperator<EqualityOperator>(token(TokenType::Equality)),
+        bindBinaryOperator<NotEqOperator>(token(TokenType::Difference)),
+        bindBinaryOperator<BitwiseAndOperator>(token(TokenType::BitwiseAnd)),
+        bindBinaryOperator<BitwiseXorOperator>(token(TokenType::BitwiseXor)),
+        bindBinaryOperator<BitwiseOrOperator>(token(TokenType::BitwiseOr)),
+        bindBinaryOperator<ConjunctionOperator>(token(TokenType::And)),
+        bindBinaryOperator<DisjunctionOperator>(token(TokenType::Or)),
+        bindBinaryOperator<AssignmentOperator>(token(TokenType::Assignment)),
+        bindBinaryOperator<PlusAssignmentOperator>(token(TokenType::PlusAssign)),
+        bindBinaryOperator<MinusAssignmentOperator>(token(TokenType::MinusAssign)),
+        bindBinaryOperator<TimesAssignmentOperator>(token(TokenType::TimesAssign)),
+        bindBinaryOperator<DivAssignmentOperator>(token(TokenType::DivAssign)),
+        bindBinaryOperator<ModAssignmentOperator>(token(TokenType::ModAssign)),
+        bindBinaryOperator<BitwiseAndAssignmentOperator>(token(TokenType::BitwiseAndAssign)),
+        bindBinaryOperator<BitwiseOrAssignmentOperator>(token(TokenType::BitwiseOrAssign)),
+        bindBinaryOperator<BitwiseXorAssignmentOperator>(token(TokenType::BitwiseXorAssign)),
+        bindBinaryOperator<LeftShiftAssignmentOperator>(token(TokenType::LeftShiftAssign)),
+        bindBinaryOperator<RightShiftAssignmentOperator>(token(TokenType::RightShiftAssign))
+};
+
+static constexpr PrefixOperatorIndex<TOKEN_TYPES> PREFIX_OPERATORS{
+        bindPrefixOperator<PreIncrOperator>(token(TokenType::Increment)),
+        bindPrefixOperator<PreDecrOperator>(token(TokenType::Decrement)),
+        bindPrefixOperator<LogicalNotOperator>(token(TokenType::LogicalNot)),
+        bindPrefixOperator<PreNegOperator>(token(TokenType::Minus))
+};
+
+static constexpr PostfixOperatorIndex<TOKEN_TYPES> POSTFIX_OPERATORS{
+        bindPostfixOperator<PostIncOperator>(token(TokenType::Increment)),
+        bindPostfixOperator<PostDecrOperator>(token(TokenType::Decrement))
+};
+
+// The binary operators bind tighter as their precedence grows, the assignments are handled apart.
+static int binaryPrecedence(TokenType type) {
+    switch (type) {
+        case TokenType::Or:
+            return 1;
+        case TokenType::And:
+            return 2;
+        case TokenType::BitwiseOr:
+            return 3;
+        case TokenType::BitwiseXor:
+            return 4;
+        case TokenType::BitwiseAnd:
+            return 5;
+        case TokenType::Equality:
+        case TokenType::Difference:
+            return 6;
+        case TokenType::LowerThan:
+        case TokenType::LowerEqThan:
+        case TokenType::GreaterThan:
+        case TokenType::GreaterEqThan:
+            return 7;
+        case TokenType::LeftShift:
+        case TokenType::RightShift:
+            return 8;
+        case TokenType::Plus:
+        case TokenType::Minus:
+            return 9;
+        case TokenType::Times:
+        case TokenType::Div:
+        case TokenType::Mod:
+            return 10;
+        default:
+            return 0;
+    }
+}
+
+static bool isAssignmentOperator(TokenType type) {
+    return type >= TokenType::Assignment && type <= TokenType::RightShiftAssign;
+}
+
+static bool isPrefixOperator(TokenType type) {
+    return type == TokenType::Minus
+           || type == TokenType::Increment
+           || type == TokenType::Decrement
+           || type == TokenType::LogicalNot
+           || type == TokenType::BitwiseNot;
+}
+
+static bool isOpeningBracket(TokenType type) {
+    return type == TokenType::LeftPar || type == TokenType::LeftBracket || type == TokenType::LeftCBracket;
+}
+
+static bool isClosingBracket(TokenType type) {
+    return type == TokenType::RightPar || type == TokenType::RightBracket || type == TokenType::RightCBracket;
+}
+
+static char characterValue(std::string const &text) {
+    char value = text.at(1);
+    if (value == '\\') {
+        if (text == "'\\n'") value = '\n';
+        else if (text == "'\\r'") value = '\r';
+        else if (text == "'\\t'") value = '\t';
+        else if (text == "'\\''") value = '\'';
+        else if (text == "'\\\"'") value = '"';
+        else if (text == "'\\\\'") value = '\\';
+        else if (text == "'\\0'") value = '\0';
+    }
+    return value;
+}
+
+Parser::Parser(utils::SourceFile::Ptr sourceFile, utils::Diagnostics::Ptr diagnostics)
+        : mSourceFile{sourceFile},
+          mDiagnostics{diagnostics},
+          mCharStream{sourceFile},
+          mErrorListener{diagnostics} {
+    mTokens = Lexer(mSourceFile->getContent(), &mCharStream, mDiagnostics).tokenize();
+}
+
+Context::Ptr Parser::parse() {
+    ContextPusher contextPusher(*this);
+    Context::Ptr context = contextPusher.getContext();
+
+    std::vector<Declaration::Ptr> preludeDeclarations = declarePrelude(
+            context, makeContext(&mTokens.front(), &mTokens.back()));
+
+    // Like the ANTLR front-end, no AST is built from a source with unknown characters
+    if (mDiagnostics->getSyntaxErrorCount() > 0) {
+        return context;
+    }
+
+    try {
+        context->addStatements(parseStatements());
+    } catch (exceptions::SemanticError &semanticError) {
+        recoverFrom(semanticError);
+    } catch (SyntaxErrorRecovery &) {
+        // Nothing to resume at
+    }
+    return context;
+}
+
+//--------------------------------------------------------------------------------------------------------
+// Statements
+
+std::vector<Statement::Ptr> Parser::parseStatements() {
+    std::vector<Statement::Ptr> statements;
+    do {
+        size_t const start = mPosition;
+        bool handled = false;
+        try {
+            if (is(TokenType::Semicolon)) {
+                next();
+            } else if (startsDeclaration()) {
+                std::vector<Statement::Ptr> declarations = parseDeclaration();
+                std::move(declarations.begin(), declarations.end(), std::back_inserter(statements));
+                handled = true;
+            } else {
+                statements.push_back(parseInstruction());
+                handled = true;
+            }
+        } catch (exceptions::SemanticError &semanticError) {
+            recoverFrom(semanticError);
+            mPosition = std::max(findStatementEnd(start), start + 1);
+        } catch (SyntaxErrorRecovery &) {
+            mPosition = std::max(findRecoveryPoint(start), start + 1);
+            handled = true;
+        }
+        if (!handled) {
+            logger.warning() << "Skipping unhandled statement:\n" << getText(start, mPosition);
+        }
+    } while (!is(TokenType::EndOfFile));
+    return statements;
+}
+
+std::vector<Statement::Ptr> Parser::parseBlock() {
+    expect(TokenType::LeftCBracket);
+    size_t const closingPosition = findClosingBracket(mPosition - 1);
+
+    std::vector<Statement::Ptr> statements;
+    while (startsDeclaration()) {
+        size_t const start = mPosition;
+        try {
+            std::vector<Statement::Ptr> declarations = parseDeclaration();
+            std::move(declarations.begin(), declarations.end(), std::back_inserter(statements));
+        } catch (exceptions::SemanticError &semanticError) {
+            recoverFrom(semanticError);
+            mPosition = std::max(findStatementEnd(start), start + 1);
+            logger.warning() << "Skipping unhandled declaration:\n" << getText(start, mPosition);
+        } catch (SyntaxErrorRecovery &) {
+            mPosition = std::max(findRecoveryPoint(start), start + 1);
+        }
+    }
+
+    // The first semantic error in the instructions drops all of them, as the ASTVisitor does
+    try {
+        std::vector<Statement::Ptr> instructions;
+        while (!is(TokenType::RightCBracket) && !is(TokenType::EndOfFile)) {
+            size_t const start = mPosition;
+            try {
+                if (startsDeclaration()) {
+                    syntaxError(peek());
+                }
+                instructions.push_back(parseInstruction());
+            } catch (SyntaxErrorRecovery &) {
+                mPosition = std::max(findRecoveryPoint(start), start + 1);
+            }
+        }
+        std::move(instructions.begin(), instructions.end(), std::back_inserter(statements));
+    } catch (exceptions::SemanticError &semanticError) {
+        recoverFrom(semanticError);
+        mPosition = closingPosition;
+    }
+
+    expect(TokenType::RightCBracket);
+    return statements;
+}
+
+std::vector<Statement::Ptr> Parser::parseDeclaration() {
+    std::vector<Statement::Ptr> declarations;
+    if (is(TokenType::Typedef)) {
+        declarations.push_back(parseTypeDefinition());
+    } else if (is(TokenType::Extern) && is(TokenType::LeftBracket, 3)) {
+        declarations.push_back(parseArrayDeclaration());
+    } else if (is(TokenType::Extern)) {
+        declarations = parseVariableDeclaration();
+    } else if (is(TokenType::LeftPar, 2)) {
+        // Function definitions are not followed by a separator, parseFunction() handles it.
+        declarations.push_back(parseFunction());
+        return declarations;
+    } else if (is(TokenType::LeftBracket, 2)) {
+        declarations.push_back(parseArrayDefinition());
+    } else {
+        declarations = parseVariableDefinition();
+    }
+    parseSeparators();
+    return declarations;
+}
+
+Statement::Ptr Parser::parseInstruction() {
+    switch (typeAt(mPosition)) {
+        case TokenType::Return:
+        case TokenType::Break: {
+            Statement::Ptr jump = parseJump();
+            parseSeparators();
+            return jump;
+        }
+        case TokenType::If:
+            return parseIfBlock();
+        case TokenType::While:
+            return parseWhileBlock();
+        case TokenType::Do:
+            return parseDoWhileBlock();
+        case TokenType::For:
+            return parseForBlock();
+        default: {
+            Expression::Ptr expression = parseExpression();
+            parseSeparators();
+            return castTo<Statement::Ptr>(expression);
+        }
+    }
+}
+
+Statement::Ptr Parser::parseTypeDefinition() {
+    antlr4::Token *startToken = expect(TokenType::Typedef);
+    TypeSymbol::Ptr primaryTypeSymbol = parseTypeParameter();
+    TypeSymbol::Ptr typeAliasDefault = parseTypeParameter();
+
+    TypeDefinition::Ptr typeDefinition = makeNode<TypeDefinition>(
+            startToken, typeAliasDefault->getName(), primaryTypeSymbol);
+    currentContext()->getSymbolTable()->addType(makeContext(startToken, previous()), typeDefinition);
+
+    return castTo<Statement::Ptr>(typeDefinition);
+}
+
+Statement::Ptr Parser::parseJump() {
+    antlr4::Token *startToken = next();
+    if (startToken->getType() == static_cast<size_t>(TokenType::Break)) {
+        return castTo<Statement::Ptr>(makeNode<BreakStatement>(startToken));
+    }
+
+    if (is(TokenType::Semicolon)) {
+        return castTo<Statement::Ptr>(makeNode<ReturnStatement>(startToken));
+    }
+    Expression::Ptr returnedExpression = parseExpression();
+    return castTo<Statement::Ptr>(makeNode<ReturnStatement>(returnedExpression, startToken));
+}
+
+//--------------------------------------------------------------------------------------------------------
+// Variables, arrays and functions
+
+std::vector<Statement::Ptr> Parser::parseVariableDeclaration() {
+    antlr4::Token *startToken = expect(TokenType::Extern);
+    antlr4::Token *typeToken = expect(TokenType::Identifier);
+    std::vector<antlr4::Token *> nameTokens{expect(TokenType::Identifier)};
+    while (is(TokenType::Comma)) {
+        next();
+        nameTokens.push_back(expect(TokenType::Identifier));
+    }
+    SourceContext *context = makeContext(startToken, previous());
+
+    TypeSymbol::Ptr typeSymbol = getTypeSymbol(typeToken);
+    std::vector<Statement::Ptr> variables;
+    for (antlr4::Token *nameToken : nameTokens) {
+        std::string name = nameToken->getText();
+        VariableSymbol::Ptr variableSymbol = makeNode<VariableSymbol>(name, typeSymbol);
+        VariableDeclaration::Ptr variableDeclaration = makeNode<VariableDeclaration>(variableSymbol, nameToken);
+        variables.push_back(variableDeclaration);
+
+        variableDeclaration->setVariableSymbol(currentContext()->getSymbolTable()->addVariableDeclaration(
+                context, typeSymbol->getType(), name, variableDeclaration));
+    }
+    return variables;
+}
+
+std::vector<Statement::Ptr> Parser::parseVariableDefinition() {
+    antlr4::Token *startToken = peek();
+    TypeSymbol::Ptr typeSymbol = parseTypeParameter();
+
+    // Find the declarators, separated by the commas outside of the initial values
+    std::vector<size_t> declarators{mPosition};
+    size_t end = mPosition;
+    for (int depth = 0; typeAt(end) != TokenType::EndOfFile; end++) {
+        TokenType type = typeAt(end);
+        if (isOpeningBracket(type)) {
+            depth++;
+        } else if (isClosingBracket(type)) {
+            if (--depth < 0) {
+                break;
+            }
+        } else if (depth == 0 && type == TokenType::Comma) {
+            declarators.push_back(end + 1);
+        } else if (depth == 0 && type == TokenType::Semicolon) {
+            break;
+        }
+    }
+    SourceContext *context = makeContext(startToken, &mTokens[end - 1]);
+
+    // The variables without value are defined first, as the ASTVisitor does
+    std::vector<Statement::Ptr> variables;
+    for (size_t declarator : declarators) {
+        mPosition = declarator;
+        antlr4::Token *nameToken = expect(TokenType::Identifier);
+        if (is(TokenType::Assignment)) {
+            continue;
+        } else if (!is(TokenType::Comma) && mPosition != end) {
+            syntaxError(peek());
+        }
+
+        VariableDefinition::Ptr variableDefinition = makeNode<VariableDefinition>(nameToken);
+        variables.push_back(variableDefinition);
+
+        VariableSymbol::Ptr variableSymbol = currentContext()->getSymbolTable()->addVariableDefinition(
+                context, typeSymbol->getType(), nameToken->getText(), variableDefinition);
+        variableDefinition->setVariableSymbol(variableSymbol);
+    }
+
+    for (size_t declarator : declarators) {
+        mPosition = declarator;
+        antlr4::Token *nameToken = expect(TokenType::Identifier);
+        if (!is(TokenType::Assignment)) {
+            continue;
+        }
+        next();
+        Expression::Ptr expression = parseExpressionNoComma();
+        if (!is(TokenType::Comma) && mPosition != end) {
+            syntaxError(peek());
+        }
+
+        VariableDefinition::Ptr variableDefinition = makeNode<VariableDefinition>(expression, nameToken);
+        variables.push_back(variableDefinition);
+
+        VariableSymbol::Ptr variableSymbol = currentContext()->getSymbolTable()->addVariableDefinition(
+                context, typeSymbol->getType(), nameToken->getText(), variableDefinition);
+        variableDefinition->setVariableSymbol(variableSymbol);
+    }
+
+    mPosition = end;
+    return variables;
+}
+
+Statement::Ptr Parser::parseArrayDeclaration() {
+    antlr4::Token *startToken = expect(TokenType::Extern);
+    antlr4::Token *typeToken = expect(TokenType::Identifier);
+    antlr4::Token *nameToken = expect(TokenType::Identifier);
+    expect(TokenType::LeftBracket);
+    antlr4::Token *sizeToken = is(TokenType::Number) ? next() : nullptr;
+    expect(TokenType::RightBracket);
+    SourceContext *context = makeContext(startToken, previous());
+
+    TypeSymbol::Ptr typeSymbol = getTypeSymbol(typeToken);
+    bool sized = sizeToken != nullptr;
+    size_t size = sized ? static_cast<size_t>(std::stoll(sizeToken->getText())) : 0;
+
+    ArrayDeclaration::Ptr arrayDeclaration = makeNode<ArrayDeclaration>(startToken);
+    ArraySymbol::Ptr arraySymbol = currentContext()->getSymbolTable()->addArrayDeclaration(
+            context, typeSymbol->getType(), nameToken->getText(), sized, size, arrayDeclaration);
+    arrayDeclaration->setSymbol(arraySymbol);
+
+    return castTo<Statement::Ptr>(arrayDeclaration);
+}
+
+Statement::Ptr Parser::parseArrayDefinition() {
+    antlr4::Token *startToken = peek();
+    antlr4::Token *typeToken = expect(TokenType::Identifier);
+    std::string name = expect(TokenType::Identifier)->getText();
+    expect(TokenType::LeftBracket);
+    antlr4::Token *sizeToken = is(TokenType::Number) ? next() : nullptr;
+    expect(TokenType::RightBracket);
+
+    bool sized = sizeToken != nullptr;
+    bool hasBlock = isAssignmentOperator(typeAt(mPosition));
+    if (!sized && !hasBlock) {
+        syntaxError(peek());
+    }
+
+    TypeSymbol::Ptr typeSymbol = getTypeSymbol(typeToken);
+    size_t size = sized ? static_cast<size_t>(std::stoll(sizeToken->getText())) : 0;
+
+    std::vector<Expression::Ptr> content;
+    if (hasBlock) {
+        next();
+        content = parseArrayBlock();
+
+        if (sized && size < content.size()) {
+            throw exceptions::ArrayBlockSizeExceedsDeclarationException(
+                    name,
+                    size,
+                    std::to_string(content.size())
+            );
+        } else if (!sized) {
+            size = content.size();
+        }
+    }
+
+    // Fill the block with default values to make it the same size as the declared size
+    while (content.size() < size) {
+        content.push_back(Constant::defaultConstant(startToken));
+    }
+
+    ArrayDefinition::Ptr arrayDefinition = makeNode<ArrayDefinition>(startToken);
+    ArraySymbol::Ptr arraySymbol = currentContext()->getSymbolTable()->addArrayDefinition(
+            makeContext(startToken, previous()), typeSymbol->getType(), name, std::move(content), arrayDefinition);
+    arrayDefinition->setSymbol(arraySymbol);
+
+    return castTo<Statement::Ptr>(arrayDefinition);
+}
+
+std::vector<Expression::Ptr> Parser::parseArrayBlock() {
+    expect(TokenType::LeftCBracket);
+    std::vector<Expression::Ptr> expressions;
+    while (!is(TokenType::RightCBracket)) {
+        expressions.push_back(parseExpressionNoComma());
+        if (!is(TokenType::Comma)) {
+            break;
+        }
+        next();
+    }
+    expect(TokenType::RightCBracket);
+    return expressions;
+}
+
+Statement::Ptr Parser::parseFunction() {
+    antlr4::Token *startToken = peek();
+    PrimaryType::Ptr returnType = parseTypeParameter()->getType();
+    std::string name = expect(TokenType::Identifier)->getText();
+    std::vector<FunctionParameterSignature> params = parseFunctionArguments();
+    SourceContext *innerContext = makeContext(startToken, previous());
+
+    if (!is(TokenType::LeftCBracket)) {
+        FunctionDeclaration::Ptr functionDeclaration = makeNode<FunctionDeclaration>(startToken);
+        FunctionSymbol::Ptr functionSymbol = rootContext()->getSymbolTable()->addFunctionDeclaration(
+                innerContext, returnType, name, params, functionDeclaration);
+        functionDeclaration->setFunctionSymbol(functionSymbol);
+        parseSeparators();
+        return castTo<Statement::Ptr>(functionDeclaration);
+    }
+
+    SourceContext *definitionContext = makeContext(startToken, &mTokens[findClosingBracket(mPosition)]);
+
+    Context::Ptr parentContext = currentContext();
+    ContextPusher contextPusher(*this);
+    Context::Ptr functionContext = contextPusher.getContext();
+
+    if (parentContext != rootContext()) {
+        logger.fatal() << "You can only declare functions in the global score, sorry.";
+        exit(1);
+    }
+
+    std::vector<Symbol::Ptr> paramsSymbols;
+    for (auto const &[paramName, paramType, paramSymbolType] : params) {
+        paramsSymbols.push_back(functionContext->getSymbolTable()->addFunctionParameter(
+                definitionContext, paramName, paramType, paramSymbolType));
+    }
+
+    FunctionDefinition::Ptr functionDefinition = makeNode<FunctionDefinition>(functionContext, startToken);
+    FunctionSymbol::Ptr functionSymbol = parentContext->getSymbolTable()->addFunctionDefinition(
+            innerContext, functionContext, returnType, name, paramsSymbols, functionDefinition
+    );
+    functionDefinition->setSymbol(functionSymbol);
+
+    for (auto &param : paramsSymbols) {
+        param->addDefinition(functionDefinition);
+    }
+
+    functionContext->addStatements(parseBlock());
+
+    return castTo<Statement::Ptr>(functionDefinition);
+}
+
+std::vector<FunctionParameterSignature> Parser::parseFunctionArguments() {
+    expect(TokenType::LeftPar);
+    std::vector<FunctionParameterSignature> params;
+    while (!is(TokenType::RightPar)) {
+        params.push_back(parseFunctionArgument());
+        if (!is(TokenType::Comma)) {
+            break;
+        }
+        next();
+    }
+    expect(TokenType::RightPar);
+    return params;
+}
+
+FunctionParameterSignature Parser::parseFunctionArgument() {
+    antlr4::Token *startToken = peek();
+    TypeSymbol::Ptr type = parseTypeParameter();
+
+    // Get the optional name, or generate a unique one
+    std::string name;
+    if (is(TokenType::Identifier)) {
+        name = next()->getText();
+    } else {
+        std::stringstream nameSS;
+        nameSS << "__unnamed_argument_" << startToken->getLine() << "_"
+               << startToken->getCharPositionInLine() << "__";
+        name = nameSS.str();
+    }
+
+    // The argument is an array, its size is not checked
+    if (is(TokenType::LeftBracket)) {
+        mPosition = findClosingBracket(mPosition);
+        expect(TokenType::RightBracket);
+        return FunctionParameterSignature(name, type->getType(), SymbolType::ArraySymbol);
+    } else {
+        return FunctionParameterSignature(name, type->getType(), SymbolType::VariableSymbol);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------
+// Control blocks
+
+Statement::Ptr Parser::parseIfBlock() {
+    antlr4::Token *startToken = expect(TokenType::If);
+    expect(TokenType::LeftPar);
+    Expression::Ptr expression = parseExpression();
+    expect(TokenType::RightPar);
+    std::vector<Statement::Ptr> thenBlock = parseBlock();
+
+    std::vector<Statement::Ptr> elseBlock;
+    if (is(TokenType::Else)) {
+        next();
+        if (is(TokenType::If)) {
+            elseBlock.push_back(parseIfBlock());
+        } else {
+            elseBlock = parseBlock();
+        }
+    }
+
+    return castTo<Statement::Ptr>(makeNode<IfBlock>(expression, thenBlock, elseBlock, startToken));
+}
+
+Statement::Ptr Parser::parseWhileBlock() {
+    antlr4::Token *startToken = expect(TokenType::While);
+    expect(TokenType::LeftPar);
+    Expression::Ptr expression = parseExpression();
+    expect(TokenType::RightPar);
+    std::vector<Statement::Ptr> block = parseBlock();
+
+    return castTo<Statement::Ptr>(makeNode<WhileBlock>(expression, block, startToken));
+}
+
+Statement::Ptr Parser::parseDoWhileBlock() {
+    antlr4::Token *startToken = expect(TokenType::Do);
+    if (!is(TokenType::LeftCBracket)) {
+        syntaxError(peek());
+    }
+
+    // The condition is built before the block, as the ASTVisitor does
+    size_t const blockPosition = mPosition;
+    mPosition = findClosingBracket(blockPosition);
+    expect(TokenType::RightCBracket);
+    expect(TokenType::While);
+    expect(TokenType::LeftPar);
+    Expression::Ptr expression = parseExpression();
+    expect(TokenType::RightPar);
+    expect(TokenType::Semicolon);
+    size_t const endPosition = mPosition;
+
+    mPosition = blockPosition;
+    std::vector<Statement::Ptr> block = parseBlock();
+    mPosition = endPosition;
+
+    return castTo<Statement::Ptr>(makeNode<Do_WhileBlock>(expression, block, startToken));
+}
+
+Statement::Ptr Parser::parseForBlock() {
+    antlr4::Token *startToken = expect(TokenType::For);
+    expect(TokenType::LeftPar);
+    Expression::Ptr begin = parseExpression();
+    expect(TokenType::Semicolon);
+    Expression::Ptr end = parseExpression();
+    expect(TokenType::Semicolon);
+    Expression::Ptr step = parseExpression();
+    expect(TokenType::RightPar);
+    std::vector<Statement::Ptr> block = parseBlock();
+
+    return castTo<Statement::Ptr>(makeNode<ForBlock>(begin, end, step, block, startToken));
+}
+
+//--------------------------------------------------------------------------------------------------------
+// Expressions
+
+Expression::Ptr Parser::parseExpression() {
+    antlr4::Token *startToken = peek();
+    Expression::Ptr expression = parseExpressionNoComma();
+    if (!is(TokenType::Comma)) {
+        return expression;
+    }
+
+    std::vector<Expression::Ptr> expressions{expression};
+    while (is(TokenType::Comma)) {
+        next();
+        expressions.push_back(parseExpressionNoComma());
+    }
+    return castTo<Expression::Ptr>(makeNode<CommaExpression>(startToken, expressions));
+}
+
+Expression::Ptr Parser::parseExpressionNoComma(int minimumPrecedence) {
+    antlr4::Token *startToken = peek();
+    Expression::Ptr left = parseUnaryExpression();
+
+    // Precedence climbing: the right operand only takes the operators which bind tighter than this one
+    for (int precedence = binaryPrecedence(typeAt(mPosition));
+         precedence > minimumPrecedence;
+         precedence = binaryPrecedence(typeAt(mPosition))) {
+        antlr4::Token *operatorToken = next();
+        Expression::Ptr right = parseExpressionNoComma(precedence);
+        left = castTo<Expression::Ptr>(makeNode<BinaryExpression>(
+                left,
+                BINARY_OPERATORS.getOpForToken(operatorToken->getType()),
+                right,
+                startToken
+        ));
+    }
+    return left;
+}
+
+Expression::Ptr Parser::parseUnaryExpression() {
+    antlr4::Token *startToken = peek();
+
+    // A cast is a parenthesized type followed by an operand
+    bool isCast = is(TokenType::LeftPar) && is(TokenType::Identifier, 1) && is(TokenType::RightPar, 2)
+                  && (is(TokenType::LeftPar, 3) || is(TokenType::Number, 3) || is(TokenType::Character, 3)
+                      || is(TokenType::Identifier, 3) || (is(TokenType::Minus, 3) && is(TokenType::Number, 4)));
+
+    if (isCast || isPrefixOperator(typeAt(mPosition))) {
+        // A cast has no operator, as in the ASTVisitor
+        antlr4::Token *operatorToken = next();
+        if (isCast) {
+            next();
+            next();
+        }
+        Expression::Ptr operand = parsePostfixUnaryExpression(parseAtomicExpression(), peek());
+        return castTo<Expression::Ptr>(makeNode<UnaryExpression>(
+                operand,
+                PREFIX_OPERATORS.getOpForToken(operatorToken->getType()),
+                startToken
+        ));
+    }
+
+    if (is(TokenType::Identifier) && !is(TokenType::LeftPar, 1)) {
+        Expression::Ptr lvalue = parseLvalue();
+        if (isAssignmentOperator(typeAt(mPosition))) {
+            antlr4::Token *operatorToken = next();
+            Expression::Ptr value = parseExpressionNoComma();
+            return castTo<Expression::Ptr>(makeNode<BinaryExpression>(
+                    lvalue,
+                    BINARY_OPERATORS.getOpForToken(operatorToken->getType()),
+                    value,
+                    startToken
+            ));
+        }
+        return parsePostfixUnaryExpression(lvalue, startToken);
+    }
+
+    return parsePostfixUnaryExpression(parseAtomicExpression(), startToken);
+}
+
+Expression::Ptr Parser::parsePostfixUnaryExpression(Expression::Ptr const &atomicExpression,
+                                                    antlr4::Token *startToken) {
+    if (!is(TokenType::Increment) && !is(TokenType::Decrement)) {
+        return atomicExpression;
+    }
+
+    antlr4::Token *operatorToken = next();
+    if (castTo<Identifier::Ptr>(atomicExpression)) {
+        return castTo<Expression::Ptr>(makeNode<UnaryExpression>(
+                atomicExpression,
+                POSTFIX_OPERATORS.getOpForToken(operatorToken->getType()),
+                startToken
+        ));
+    }
+    return atomicExpression;
+}
+
+Expression::Ptr Parser::parseAtomicExpression() {
+    antlr4::Token *startToken = peek();
+    switch (typeAt(mPosition)) {
+        case TokenType::LeftPar: {
+            next();
+            Expression::Ptr expression = parseExpression();
+            expect(TokenType::RightPar);
+            return expression;
+        }
+        case TokenType::Number:
+            next();
+            return castTo<Expression::Ptr>(makeNode<Constant>(std::stoll(startToken->getText()), startToken));
+        case TokenType::Minus: {
+            next();
+            antlr4::Token *numberToken = expect(TokenType::Number);
+            long long value = std::stoll("-" + numberToken->getText());
+            return castTo<Expression::Ptr>(makeNode<Constant>(value, startToken));
+        }
+        case TokenType::Character:
+            next();
+            return castTo<Expression::Ptr>(makeNode<Constant>(characterValue(startToken->getText()), startToken));
+        case TokenType::Identifier: {
+            if (!is(TokenType::LeftPar, 1)) {
+                return parseLvalue();
+            }
+            next();
+            std::vector<Expression::Ptr> arguments = parseCallArguments();
+            FunctionCall::Ptr functionCall = makeNode<FunctionCall>(std::move(arguments), startToken);
+            FunctionSymbol::Ptr functionSymbol = currentContext()->getSymbolTable()->addFunctionCall(
+                    makeContext(startToken, previous()), startToken->getText(), functionCall);
+            functionCall->setSymbol(functionSymbol);
+            return castTo<Expression::Ptr>(functionCall);
+        }
+        default:
+            syntaxError(startToken);
+    }
+}
+
+Expression::Ptr Parser::parseLvalue() {
+    antlr4::Token *startToken = expect(TokenType::Identifier);
+    std::string name = startToken->getText();
+
+    if (is(TokenType::LeftBracket)) {
+        next();
+        Expression::Ptr index = parseExpression();
+        expect(TokenType::RightBracket);
+        ArrayAccess::Ptr arrayAccess = makeNode<ArrayAccess>(index, startToken);
+        ArraySymbol::Ptr arraySymbol = currentContext()->getSymbolTable()->addArrayAccess(
+                makeContext(startToken, previous()), name, arrayAccess);
+        arrayAccess->setSymbol(arraySymbol);
+        return castTo<Expression::Ptr>(arrayAccess);
+    }
+
+    Identifier::Ptr identifier = makeNode<Identifier>(startToken);
+    Symbol::Ptr symbol = currentContext()->getSymbolTable()->addVariableUsage(
+            makeContext(startToken, startToken), name, identifier);
+    identifier->setSymbol(symbol);
+    return castTo<Expression::Ptr>(identifier);
+}
+
+std::vector<Expression::Ptr> Parser::parseCallArguments() {
+    expect(TokenType::LeftPar);
+    std::vector<Expression::Ptr> arguments;
+    while (!is(TokenType::RightPar)) {
+        arguments.push_back(parseExpressionNoComma());
+        if (!is(TokenType::Comma)) {
+            break;
+        }
+        next();
+    }
+    expect(TokenType::RightPar);
+    return arguments;
+}
+
+//--------------------------------------------------------------------------------------------------------
+// Helpers
+
+TypeSymbol::Ptr Parser::parseTypeParameter() {
+    return getTypeSymbol(expect(TokenType::Identifier));
+}
+
+TypeSymbol::Ptr Parser::getTypeSymbol(antlr4::Token *typeToken) {
+    std::string symbolName = typeToken->getText();
+    if (currentContext()->getSymbolTable()->hasSymbol(symbolName)) {
+        Symbol::Ptr symbol = currentContext()->getSymbolTable()->getSymbol(
+                makeContext(typeToken, typeToken), symbolName);
+        return castTo<TypeSymbol::Ptr>(symbol);
+    } else {
+        throw std::runtime_error("Default symbol " + symbolName + " is created with void_t as return type");
+    }
+}
+
+void Parser::parseSeparators() {
+    expect(TokenType::Semicolon);
+    while (is(TokenType::Semicolon)) {
+        next();
+    }
+}
+
+antlr4::Token *Parser::peek(size_t offset) {
+    return &mTokens[std::min(mPosition + offset, mTokens.size() - 1)];
+}
+
+antlr4::Token *Parser::previous() {
+    return &mTokens[mPosition - 1];
+}
+
+antlr4::Token *Parser::next() {
+    antlr4::Token *token = peek();
+    if (mPosition < mTokens.size() - 1) {
+        mPosition++;
+    }
+    return token;
+}
+
+antlr4::Token *Parser::expect(TokenType type) {
+    if (!is(type)) {
+        syntaxError(peek());
+    }
+    return next();
+}
+
+bool Parser::is(TokenType type, size_t offset) {
+    return peek(offset)->getType() == static_cast<size_t>(type);
+}
+
+TokenType Parser::typeAt(size_t position) {
+    return static_cast<TokenType>(mTokens[std::min(position, mTokens.size() - 1)].getType());
+}
+
+bool Parser::startsDeclaration() {
+    return is(TokenType::Typedef)
+           || is(TokenType::Extern)
+           || (is(TokenType::Identifier) && is(TokenType::Identifier, 1));
+}
+
+void Parser::syntaxError(antlr4::Token *offendingToken) {
+    antlr4::ANTLRErrorListener &errorListener = mErrorListener;
+    errorListener.syntaxError(
+            nullptr, offendingToken, offendingToken->getLine(), offendingToken->getCharPositionInLine(),
+            "mismatched input '" + offendingToken->getText() + "'", nullptr
+    );
+    throw SyntaxErrorRecovery{};
+}
+
+SourceContext *Parser::makeContext(antlr4::Token *startToken, antlr4::Token *stopToken) {
+    return &mContexts.emplace_back(mTokens, startToken, stopToken);
+}
+
+size_t Parser::findClosingBracket(size_t openingPosition) {
+    int depth = 0;
+    size_t position = openingPosition;
+    for (; typeAt(position) != TokenType::EndOfFile; position++) {
+        TokenType type = typeAt(position);
+        if (isOpeningBracket(type)) {
+            depth++;
+        } else if (isClosingBracket(type) && --depth == 0) {
+            break;
+        }
+    }
+    return position;
+}
+
+size_t Parser::findStatementEnd(size_t startPosition) {
+    TokenType const firstType = typeAt(startPosition);
+    bool const isControlBlock = firstType == TokenType::If
+                                || firstType == TokenType::While
+                                || firstType == TokenType::For;
+
+    int depth = 0;
+    size_t position = startPosition;
+    while (typeAt(position) != TokenType::EndOfFile) {
+        TokenType type = typeAt(position);
+        if (isOpeningBracket(type)) {
+            depth++;
+        } else if (isClosingBracket(type)) {
+            if (--depth < 0) {
+                // The closing bracket of the enclosing block
+                return position;
+            }
+            if (depth == 0 && type == TokenType::RightCBracket) {
+                TokenType following = typeAt(position + 1);
+                bool continues = following == TokenType::Else
+                                 || (firstType == TokenType::Do && following == TokenType::While)
+                                 || (!isControlBlock && following == TokenType::Semicolon);
+                if (!continues) {
+                    return position + 1;
+                }
+            }
+        } else if (depth == 0 && type == TokenType::Semicolon) {
+            while (typeAt(position) == TokenType::Semicolon) {
+                position++;
+            }
+            return position;
+        }
+        position++;
+    }
+    return position;
+}
+
+size_t Parser::findRecoveryPoint(size_t startPosition) {
+    // Only the braces are counted, a syntax error often leaves a parenthesis or a bracket open
+    int depth = 0;
+    size_t position = startPosition;
+    for (; typeAt(position) != TokenType::EndOfFile; position++) {
+        TokenType type = typeAt(position);
+        if (type == TokenType::LeftCBracket) {
+            depth++;
+        } else if (type == TokenType::RightCBracket) {
+            if (--depth < 0) {
+                // The closing brace of the enclosing block
+                return position;
+            }
+            if (depth == 0) {
+                return position + 1;
+            }
+        } else if (depth == 0 && type == TokenType::Semicolon) {
+            return position + 1;
+        }
+    }
+    return position;
+}
+
+std::string Parser::getText(size_t startPosition, size_t stopPosition) {
+    std::string text;
+    for (size_t position = startPosition; position < stopPosition && position < mTokens.size(); position++) {
+        if (typeAt(position) != TokenType::EndOfFile) {
+            text += mTokens[position].getText();
+        }
+    }
+    return text;
+}
+
+std::shared_ptr<Context> Parser::rootContext() {
+    Context::Ptr context = currentContext();
+    while (context->getParent()) {
+        context = context->getParent();
+    }
+    return context;
+}
+
+std::shared_ptr<Context> Parser::currentContext() {
+    return mContextStack.top();
+}
+
+void Parser::recoverFrom(exceptions::SemanticError const &semanticError) {
+    mDiagnostics->semanticError(semanticError);
+}
+
+} // namespace caramel::parser
@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "Lexer.h"
+#include "SourceContext.h"
+#include "SourceCharStream.h"
+#include "../ast/context/Context.h"
+#include "../ast/symboltable/TypeSymbol.h"
+#include "../ast/symboltable/FunctionParameterSignature.h"
+#include "../ast/statements/expressions/Expression.h"
+#include "../exceptions/SemanticError.h"
+#include "../listeners/errorlistener/ParserErrorListener.h"
+#include "../utils/Diagnostics.h"
+
+#include <deque>
+#include <stack>
+#include <string>
+#include <vector>
+
+
+namespace caramel::parser {
+
+/**
+ * Hand-written front-end: a recursive descent parser for the statements and a Pratt parser for the expressions.
+ * It builds the same AST as the ANTLR parser and the ASTVisitor, in a single pass over the tokens.
+ */
+class Parser {
+public:
+    Parser(utils::SourceFile::Ptr sourceFile, utils::Diagnostics::Ptr diagnostics);
+
+    /// Returns the root context of the AST. The errors are collected in the diagnostics.
+    ast::Context::Ptr parse();
+
+private:
+    class ContextPusher;
+
+    /// Thrown once a syntax error is collected, to resume parsing at the next statement.
+    struct SyntaxErrorRecovery {};
+
+    //--------------------------------------------------------------------------------------------------------
+    // Statements
+
+    std::vector<ast::Statement::Ptr> parseStatements();
+    std::vector<ast::Statement::Ptr> parseBlock();
+    std::vector<ast::Statement::Ptr> parseDeclaration();
+    ast::Statement::Ptr parseInstruction();
+    ast::Statement::Ptr parseTypeDefinition();
+    ast::Statement::Ptr parseJump();
+
+    //--------------------------------------------------------------------------------------------------------
+    // Variables, arrays and functions
+
+    std::vector<ast::Statement::Ptr> parseVariableDeclaration();
+    std::vector<ast::Statement::Ptr> parseVariableDefinition();
+    ast::Statement::Ptr parseArrayDeclaration();
+    ast::Statement::Ptr parseArrayDefinition();
+    std::vector<ast::Expression::Ptr> parseArrayBlock();
+    ast::Statement::Ptr parseFunction();
+    std::vector<ast::FunctionParameterSignature> parseFunctionArguments();
+    ast::FunctionParameterSignature parseFunctionArgument();
+
+    //--------------------------------------------------------------------------------------------------------
+    // Control blocks
+
+    ast::Statement::Ptr parseIfBlock();
+    ast::Statement::Ptr parseWhileBlock();
+    ast::Statement::Ptr parseDoWhileBlock();
+    ast::Statement::Ptr parseForBlock();
+
+    //--------------------------------------------------------------------------------------------------------
+    // Expressions
+
+    ast::Expression::Ptr parseExpression();
+    ast::Expression::Ptr parseExpressionNoComma(int minimumPrecedence = 0);
+    ast::Expression::Ptr parseUnaryExpression();
+    ast::Expression::Ptr parsePostfixUnaryExpression(ast::Expression::Ptr const &atomicExpression,
+                                                     antlr4::Token *startToken);
+    ast::Expression::Ptr parseAtomicExpression();
+    ast::Expression::Ptr parseLvalue();
+    std::vector<ast::Expression::Ptr> parseCallArguments();
+
+    //--------------------------------------------------------------------------------------------------------
+    // Helpers
+
+    ast::TypeSymbol::Ptr parseTypeParameter();
+    ast::TypeSymbol::Ptr getTypeSymbol(antlr4::Token *typeToken);
+    void parseSeparators();
+
+    antlr4::Token *peek(size_t offset = 0);
+    antlr4::Token *previous();
+    antlr4::Token *next();
+    antlr4::Token *expect(TokenType type);
+    bool is(TokenType type, size_t offset = 0);
+    TokenType typeAt(size_t position);
+    bool startsDeclaration();
+    [[noreturn]] void syntaxError(antlr4::Token *offendingToken);
+
+    SourceContext *makeContext(antlr4::Token *startToken, antlr4::Token *stopToken);
+    size_t findClosingBracket(size_t openingPosition);
+    size_t findStatementEnd(size_t startPosition);
+    size_t findRecoveryPoint(size_t startPosition);
+    std::string getText(size_t startPosition, size_t stopPosition);
+
+    std::shared_ptr<ast::Context> rootContext();
+    std::shared_ptr<ast::Context> currentContext();
+    void recoverFrom(exceptions::SemanticError const &semanticError);
+
+private:
+    utils::SourceFile::Ptr mSourceFile;
+    utils::Diagnostics::Ptr mDiagnostics;
+    SourceCharStream mCharStream;
+    listeners::ParserErrorListener mErrorListener;
+    std::deque<antlr4::CommonToken> mTokens;
+    std::deque<SourceContext> mContexts;
+    size_t mPosition = 0;
+
+    std::stack<std::shared_ptr<ast::Context>> mContextStack;
+};
+
+} // namespace caramel::parser
@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "SourceCharStream.h"
+
+#include <misc/Interval.h>
+
+
+namespace caramel::parser {
+
+SourceCharStream::SourceCharStream(utils::SourceFile::Ptr sourceFile)
+        : mSourceFile{std::move(sourceFile)},
+          mContent{mSourceFile->getContent()},
+          mPosition{0} {}
+
+std::string SourceCharStream::getText(antlr4::misc::Interval const &interval) {
+    size_t const start = static_cast<size_t>(interval.a);
+    size_t const stop = static_cast<size_t>(interval.b);
+    if (interval.a < 0 || start >= mContent.length() || stop < start) {
+        return "";
+    }
+    return std::string{mContent.substr(start, stop - start + 1)};
+}
+
+std::string SourceCharStream::toString() const {
+    return std::string{mContent};
+}
+
+void SourceCharStream::consume() {
+    if (mPosition < mContent.length()) {
+        mPosition++;
+    }
+}
+
+size_t SourceCharStream::LA(ssize_t i) {
+    if (i == 0) {
+        return 0;
+    }
+    ssize_t const position = static_cast<ssize_t>(mPosition) + (i > 0 ? i - 1 : i);
+    if (position < 0 || static_cast<size_t>(position) >= mContent.length()) {
+        return antlr4::IntStream::EOF;
+    }
+    return static_cast<unsigned char>(mContent[static_cast<size_t>(position)]);
+}
+
+ssize_t SourceCharStream::mark() {
+    return -1;
+}
+
+void SourceCharStream::release(ssize_t) {}
+
+size_t SourceCharStream::index() {
+    return mPosition;
+}
+
+void SourceCharStream::seek(size_t index) {
+    mPosition = std::min(index, mContent.length());
+}
+
+size_t SourceCharStream::size() {
+    return mContent.length();
+}
+
+std::string SourceCharStream::getSourceName() const {
+    return mSourceFile->getFileName();
+}
+
+} // namespace caramel::parser
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "../utils/SourceFile.h"
+
+#include <CharStream.h>
+
+
+namespace caramel::parser {
+
+/**
+ * A read-only CharStream over a mapped source file.
+ * The hand-written lexer does not read from it: the tokens only keep it to compute their text on demand,
+ * so that a token is a span into the mapping instead of a copied string.
+ */
+class SourceCharStream : public antlr4::CharStream {
+public:
+    explicit SourceCharStream(utils::SourceFile::Ptr sourceFile);
+    ~SourceCharStream() override = default;
+
+    std::string getText(antlr4::misc::Interval const &interval) override;
+    std::string toString() const override;
+
+    void consume() override;
+    size_t LA(ssize_t i) override;
+    ssize_t mark() override;
+    void release(ssize_t marker) override;
+    size_t index() override;
+    void seek(size_t index) override;
+    size_t size() override;
+    std::string getSourceName() const override;
+
+private:
+    utils::SourceFile::Ptr mSourceFile;
+    std::string_view mContent;
+    size_t mPosition;
+};
+
+} // namespace caramel::parser
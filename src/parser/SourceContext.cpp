@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (c) 2018 Kalate Hexanome, 4IF, INSA Lyon
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,32 +22,27 @@
  * SOFTWARE.
 */
 
-#include "PrefixOperatorIndex.h"
-#include "PreIncrOperator.h"
-#include "PreDecrOperator.h"
-#include "LogicalNotOperator.h"
-#include "PreNegOperator.h"
+#include "SourceContext.h"
 
-#define BIND(op) index.insert(make_pair(op::SYMBOL, dynamic_pointer_cast<UnaryOperator>(make_shared<op>())))
 
-using namespace std;
+namespace caramel::parser {
 
-caramel::ast::PrefixOperatorIndex::PrefixOperatorIndex() {
-
-    BIND(PreIncrOperator);
-    BIND(PreDecrOperator);
-
-    BIND(LogicalNotOperator);
-
-    BIND(PreNegOperator);
+SourceContext::SourceContext(std::deque<antlr4::CommonToken> const &tokens,
+                             antlr4::Token *startToken,
+                             antlr4::Token *stopToken)
+        : mTokens{tokens} {
+    start = startToken;
+    stop = stopToken;
 }
 
-caramel::ast::UnaryOperator::Ptr caramel::ast::PrefixOperatorIndex::getOpForToken(std::string token) {
-    auto it = index.find(token);
-
-    if (it == index.end()) {
-        return nullptr;
+std::string SourceContext::getText() {
+    std::string text;
+    for (size_t i = start->getTokenIndex(); i <= stop->getTokenIndex() && i < mTokens.size(); i++) {
+        if (mTokens[i].getType() != antlr4::Token::EOF) {
+            text += mTokens[i].getText();
+        }
     }
+    return text;
+}
 
-    return it->second;
-}
\ No newline at end of file
+} // namespace caramel::parser
@@ -0,0 +1,52 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include <CommonToken.h>
+#include <ParserRuleContext.h>
+
+#include <deque>
+#include <string>
+
+
+namespace caramel::parser {
+
+/**
+ * The span of tokens of a construct parsed by the hand-written parser.
+ * It stands for the ANTLR rule context in the symbol table calls and in the semantic errors.
+ */
+class SourceContext : public antlr4::ParserRuleContext {
+public:
+    SourceContext(std::deque<antlr4::CommonToken> const &tokens, antlr4::Token *startToken, antlr4::Token *stopToken);
+    ~SourceContext() override = default;
+
+    /// The text of the tokens between start and stop, without whitespace, as ANTLR would return it.
+    std::string getText() override;
+
+private:
+    std::deque<antlr4::CommonToken> const &mTokens;
+};
+
+} // namespace caramel::parser
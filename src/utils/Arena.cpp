@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace caramel::utils {
+
+thread_local Arena *Arena::sCurrent = nullptr;
+
+Arena::Arena(size_t blockSize)
+        : mBlockSize{blockSize},
+          mBlocks{},
+          mCursor{nullptr},
+          mEnd{nullptr},
+          mAllocatedSize{0},
+          mChildren{} {}
+
+void *Arena::allocate(size_t size, size_t alignment) {
+    auto const address = reinterpret_cast<std::uintptr_t>(mCursor);
+    size_t padding = (alignment - address % alignment) % alignment;
+    if (!mCursor || size + padding > size_t(mEnd - mCursor)) {
+        // Big nodes get a block of their own
+        size_t const blockSize = std::max(mBlockSize, size + alignment);
+        mBlocks.emplace_back(new std::byte[blockSize]);
+        mCursor = mBlocks.back().get();
+        mEnd = mCursor + blockSize;
+        padding = (alignment - reinterpret_cast<std::uintptr_t>(mCursor) % alignment) % alignment;
+    }
+
+    void *allocated = mCursor + padding;
+    mCursor += padding + size;
+    mAllocatedSize += size;
+    return allocated;
+}
+
+Arena &Arena::createChild() {
+    std::lock_guard<std::mutex> lock{mChildrenMutex};
+    mChildren.push_back(std::make_unique<Arena>(mBlockSize));
+    return *mChildren.back();
+}
+
+size_t Arena::getAllocatedSize() const {
+    std::lock_guard<std::mutex> lock{mChildrenMutex};
+    size_t allocatedSize = mAllocatedSize;
+    for (auto const &child : mChildren) {
+        allocatedSize += child->getAllocatedSize();
+    }
+    return allocatedSize;
+}
+
+Arena *Arena::current() {
+    return sCurrent;
+}
+
+ArenaScope::ArenaScope(Arena &arena) : ArenaScope{&arena} {}
+
+ArenaScope::ArenaScope(Arena *arena) : mPrevious{Arena::sCurrent} {
+    Arena::sCurrent = arena;
+}
+
+ArenaScope::~ArenaScope() {
+    Arena::sCurrent = mPrevious;
+}
+
+} // namespace caramel::utils
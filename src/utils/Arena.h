@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace caramel::utils {
+
+/**
+ * Bump allocator owning the AST and IR nodes of a translation unit.
+ * The memory is only released when the arena is destroyed.
+ *
+ * An arena is used by a single thread, so the allocations take no lock.
+ * The parallel tasks allocate in child arenas, which live as long as their parent.
+ */
+class Arena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 1U << 20U;
+
+public:
+    explicit Arena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~Arena() = default;
+
+    Arena(Arena const &) = delete;
+    Arena &operator=(Arena const &) = delete;
+
+    void *allocate(size_t size, size_t alignment);
+
+    /**
+     * A new arena for a task running on another thread, released with this one.
+     */
+    Arena &createChild();
+
+    size_t getAllocatedSize() const;
+
+    /**
+     * The arena in which this thread allocates the nodes, or nullptr to use the heap.
+     */
+    static Arena *current();
+
+private:
+    friend class ArenaScope;
+    static thread_local Arena *sCurrent;
+
+    size_t mBlockSize;
+    std::vector<std::unique_ptr<std::byte[]>> mBlocks;
+    std::byte *mCursor;
+    std::byte *mEnd;
+    size_t mAllocatedSize;
+
+    std::vector<std::unique_ptr<Arena>> mChildren;
+    mutable std::mutex mChildrenMutex;
+};
+
+/**
+ * Makes an arena the current one of this thread for its lifetime.
+ */
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena &arena);
+    explicit ArenaScope(Arena *arena);
+    ~ArenaScope();
+
+    ArenaScope(ArenaScope const &) = delete;
+    ArenaScope &operator=(ArenaScope const &) = delete;
+
+private:
+    Arena *mPrevious;
+};
+
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena *arena) : mArena{arena} {}
+
+    template<typename U>
+    ArenaAllocator(ArenaAllocator<U> const &other) : mArena{other.getArena()} {}
+
+    T *allocate(size_t n) {
+        return static_cast<T *>(mArena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *, size_t) {
+        // Released with the arena
+    }
+
+    Arena *getArena() const {
+        return mArena;
+    }
+
+    template<typename U>
+    bool operator==(ArenaAllocator<U> const &other) const {
+        return mArena == other.getArena();
+    }
+
+    template<typename U>
+    bool operator!=(ArenaAllocator<U> const &other) const {
+        return mArena != other.getArena();
+    }
+
+private:
+    Arena *mArena;
+};
+
+/**
+ * Allocates a node, and its reference count, in the current arena.
+ */
+template<typename T, typename... Args>
+std::shared_ptr<T> makeNode(Args &&... args) {
+    if (Arena *arena = Arena::current()) {
+        return std::allocate_shared<T>(ArenaAllocator<T>{arena}, std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+} // namespace caramel::utils
@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Diagnostics.h"
+#include "../Console.h"
+#include "../Logger.h"
+#include "../exceptions/SemanticError.h"
+
+#include <sstream>
+
+
+namespace caramel::utils {
+
+using namespace colors;
+
+Diagnostics::Diagnostics(SourceFile::Ptr sourceFile, size_t errorLimit)
+        : mSourceFileUtil{std::move(sourceFile)},
+          mErrorLimit{errorLimit} {
+    if (mErrorLimit != 0) {
+        mErrors.reserve(mErrorLimit);
+    }
+}
+
+void Diagnostics::syntaxError(size_t line, size_t column, std::string const &offendingText) {
+    std::stringstream ss;
+    ss << "Error at line " << line << ':' << column << std::endl
+       << red << mSourceFileUtil.getLine(line) << reset << std::endl;
+    ss.width(column + 2); // + 2 is for the "^ " length
+    ss << "^ ";
+    ss.width();
+    ss << "Unexpected \"" << offendingText << "\"" << std::endl;
+
+    // The semantic errors found so far were checked on an invalid program
+    if (mSyntaxErrorCount == 0 && mSemanticErrorCount > 0) {
+        mErrors.clear();
+        mSemanticErrorCount = 0;
+    }
+    mSyntaxErrorCount++;
+    add(ss.str());
+}
+
+void Diagnostics::semanticError(exceptions::SemanticError const &semanticError) {
+    if (mSyntaxErrorCount > 0) {
+        return;
+    }
+
+    std::stringstream ss;
+    semanticError.explain(mSourceFileUtil, ss);
+
+    mSemanticErrorCount++;
+    add(ss.str());
+}
+
+size_t Diagnostics::getSyntaxErrorCount() const {
+    return mSyntaxErrorCount;
+}
+
+size_t Diagnostics::getSemanticErrorCount() const {
+    return mSemanticErrorCount;
+}
+
+bool Diagnostics::hasErrors() const {
+    return !mErrors.empty();
+}
+
+void Diagnostics::report() const {
+    for (std::string const &error : mErrors) {
+        std::cerr << error;
+    }
+
+    if (mSyntaxErrorCount > 0) {
+        if (mSyntaxErrorCount == 1) {
+            logger.fatal() << "There was one syntax error.";
+        } else {
+            logger.fatal() << "There were " << mSyntaxErrorCount << " syntax errors.";
+        }
+    } else if (mSemanticErrorCount == 1) {
+        logger.fatal() << "There was one semantic error.";
+    } else if (mSemanticErrorCount > 1) {
+        logger.fatal() << "There were " << mSemanticErrorCount << " semantic errors.";
+    }
+}
+
+void Diagnostics::add(std::string text) {
+    mErrors.push_back(std::move(text));
+
+    if (mErrorLimit != 0 && mErrors.size() >= mErrorLimit) {
+        report();
+        logger.fatal() << "Stopping after " << mErrorLimit << " errors.";
+        exit(1);
+    }
+}
+
+} // namespace caramel::utils
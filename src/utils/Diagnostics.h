@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include "SourceFileUtil.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace caramel::exceptions {
+class SemanticError;
+} // namespace caramel::exceptions
+
+namespace caramel::utils {
+
+/**
+ * Collects the syntax and semantic errors of a source file, so they can all be reported after one compilation.
+ * The buffer is bounded by the error limit: reaching it reports what was collected and exits.
+ */
+class Diagnostics {
+public:
+    using Ptr = std::shared_ptr<Diagnostics>;
+
+    /// An error limit of 0 never stops the compilation.
+    Diagnostics(SourceFile::Ptr sourceFile, size_t errorLimit);
+
+    void syntaxError(size_t line, size_t column, std::string const &offendingText);
+
+    /// Semantic errors are only kept while there are no syntax errors, they are meaningless on an invalid program.
+    void semanticError(exceptions::SemanticError const &semanticError);
+
+    size_t getSyntaxErrorCount() const;
+    size_t getSemanticErrorCount() const;
+    bool hasErrors() const;
+
+    /// Prints the collected errors in the order they were found, then their count.
+    void report() const;
+
+private:
+    void add(std::string text);
+
+    SourceFileUtil mSourceFileUtil;
+    size_t mErrorLimit;
+    std::vector<std::string> mErrors;
+    size_t mSyntaxErrorCount = 0;
+    size_t mSemanticErrorCount = 0;
+};
+
+} // namespace caramel::utils
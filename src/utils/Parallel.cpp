@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace caramel::utils {
+
+/**
+ * A range of indices [begin, end), packed in a single atomic word so that
+ * the owner and the thieves can both shrink it with a compare-and-swap.
+ */
+class WorkRange {
+public:
+    void reset(uint32_t begin, uint32_t end) {
+        mRange.store(pack(begin, end));
+    }
+
+    bool popFront(size_t &index) {
+        uint64_t range = mRange.load();
+        while (begin(range) < end(range)) {
+            if (mRange.compare_exchange_weak(range, pack(begin(range) + 1, end(range)))) {
+                index = begin(range);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool popBack(size_t &index) {
+        uint64_t range = mRange.load();
+        while (begin(range) < end(range)) {
+            if (mRange.compare_exchange_weak(range, pack(begin(range), end(range) - 1))) {
+                index = end(range) - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static uint64_t pack(uint32_t begin, uint32_t end) {
+        return uint64_t(begin) << 32U | end;
+    }
+    static uint32_t begin(uint64_t range) {
+        return uint32_t(range >> 32U);
+    }
+    static uint32_t end(uint64_t range) {
+        return uint32_t(range);
+    }
+
+    std::atomic<uint64_t> mRange{0};
+};
+
+size_t workerCount(size_t jobs) {
+    if (jobs == 0) {
+        jobs = std::thread::hardware_concurrency();
+    }
+    return jobs == 0 ? 1 : jobs;
+}
+
+void parallelFor(size_t count, size_t jobs, std::function<void(size_t)> const &task) {
+    size_t const workers = std::min(workerCount(jobs), count);
+    if (workers <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::vector<WorkRange> ranges(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        ranges[w].reset(uint32_t(count * w / workers), uint32_t(count * (w + 1) / workers));
+    }
+
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto work = [&](size_t self) {
+        try {
+            size_t index;
+            while (ranges[self].popFront(index)) {
+                task(index);
+            }
+            for (size_t victim = (self + 1) % workers; victim != self; victim = (victim + 1) % workers) {
+                while (ranges[victim].popBack(index)) {
+                    task(index);
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{errorMutex};
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    // The calling thread is the worker 0
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t w = 1; w < workers; ++w) {
+        threads.emplace_back(work, w);
+    }
+    work(0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace caramel::utils
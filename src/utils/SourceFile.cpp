@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "SourceFile.h"
+#include "../Logger.h"
+
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+namespace caramel::utils {
+
+SourceFile::SourceFile(std::string const &fileName)
+        : mFileName{fileName}, mData{nullptr}, mSize{0} {
+    logger.trace() << "New SourceFile(" << fileName << ")";
+
+    int fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+    struct stat fileStatus{};
+    if (fileDescriptor < 0 || ::fstat(fileDescriptor, &fileStatus) < 0) {
+        logger.fatal() << "Cannot read " << fileName << ": " << std::strerror(errno);
+        exit(1);
+    }
+
+    // An empty file cannot be mapped, its content is an empty view
+    mSize = static_cast<size_t>(fileStatus.st_size);
+    if (mSize > 0) {
+        void *data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (data == MAP_FAILED) {
+            logger.fatal() << "Cannot map " << fileName << ": " << std::strerror(errno);
+            exit(1);
+        }
+        mData = static_cast<char const *>(data);
+    }
+    ::close(fileDescriptor);
+}
+
+SourceFile::~SourceFile() {
+    if (mData != nullptr) {
+        ::munmap(const_cast<char *>(mData), mSize);
+    }
+}
+
+std::string const &SourceFile::getFileName() const {
+    return mFileName;
+}
+
+std::string_view SourceFile::getContent() const {
+    return std::string_view(mData, mSize);
+}
+
+std::string_view SourceFile::getLine(size_t line) const {
+    std::call_once(mLinesIndexed, &SourceFile::indexLines, this);
+
+    if (line == 0 || line > mLineStarts.size()) {
+        return {};
+    }
+    size_t const start = mLineStarts[line - 1];
+    size_t const end = line < mLineStarts.size() ? mLineStarts[line] - 1 : mSize;
+    return getContent().substr(start, end - start);
+}
+
+size_t SourceFile::getLineCount() const {
+    std::call_once(mLinesIndexed, &SourceFile::indexLines, this);
+    return mLineStarts.size();
+}
+
+void SourceFile::indexLines() const {
+    std::string_view content = getContent();
+    mLineStarts.push_back(0);
+    for (size_t end = content.find('\n'); end != std::string_view::npos; end = content.find('\n', end + 1)) {
+        mLineStarts.push_back(end + 1);
+    }
+}
+
+} // namespace caramel::utils
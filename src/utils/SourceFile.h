@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace caramel::utils {
+
+/**
+ * A source file mapped read-only in memory, shared by the lexers and the diagnostics.
+ * The content is never copied: the views and tokens point into the mapping, which lives as long as the Ptr.
+ */
+class SourceFile {
+public:
+    using Ptr = std::shared_ptr<SourceFile>;
+
+    /// Maps the whole file. Exits if it cannot be read.
+    explicit SourceFile(std::string const &fileName);
+    SourceFile(SourceFile const &) = delete;
+    SourceFile &operator=(SourceFile const &) = delete;
+    virtual ~SourceFile();
+
+    std::string const &getFileName() const;
+    std::string_view getContent() const;
+
+    /// Returns the given line (starting at 1) without its line break, or an empty view past the end.
+    std::string_view getLine(size_t line) const;
+    size_t getLineCount() const;
+
+private:
+    /// The line starts are only indexed on the first diagnostic, in one pass over the content.
+    void indexLines() const;
+
+    std::string mFileName;
+    char const *mData;
+    size_t mSize;
+
+    mutable std::once_flag mLinesIndexed;
+    mutable std::vector<size_t> mLineStarts;
+};
+
+} // namespace caramel::utils
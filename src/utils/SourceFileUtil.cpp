@@ -27,23 +27,13 @@
 
 namespace caramel::utils {
 
-SourceFileUtil::SourceFileUtil(const std::string &fileName)
-        : mFileName(fileName), mInputStream(fileName) {
-    logger.trace() << "New SourceFileUtil(" << fileName << ")";
+SourceFileUtil::SourceFileUtil(SourceFile::Ptr sourceFile)
+        : mSourceFile{std::move(sourceFile)} {
+    logger.trace() << "New SourceFileUtil(" << mSourceFile->getFileName() << ")";
 }
 
-std::string SourceFileUtil::getLine(size_t line, size_t currentCursorLine, bool resetToHead) {
-    std::string buffer;
-    size_t i = currentCursorLine;
-    while (i < line - 1) { // Moves the cursor to the right line
-        mInputStream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        i++;
-    }
-    std::getline(mInputStream, buffer);
-    if (resetToHead) {
-        mInputStream.seekg(0);
-    }
-    return buffer;
+std::string_view SourceFileUtil::getLine(size_t line) const {
+    return mSourceFile->getLine(line);
 }
 
 } // namespace caramel::utils
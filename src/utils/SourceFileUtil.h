@@ -24,7 +24,10 @@
 
 #pragma once
 
-#include <fstream>
+#include "SourceFile.h"
+
+#include <string>
+#include <string_view>
 
 namespace caramel::utils {
 
@@ -34,23 +37,19 @@ namespace caramel::utils {
 class SourceFileUtil {
 
 public:
-    explicit SourceFileUtil(const std::string &fileName);
+    explicit SourceFileUtil(SourceFile::Ptr sourceFile);
 
     virtual ~SourceFileUtil() = default;
 
     /**
-     * Return the line at `line` line of the source code
-     * Pre : 0 <= currentCursorLine <= line < number of lines in the cursor
-     * @param line The line number
-     * @param currentCursorLine Indicate the cursor line position in the source code (default to 0)
-     * @param resetToHead Indicates if the cursor must be moved to the beginning of the source code
-     * @return the line of the source code
+     * Return the line at `line` line of the source code, in constant time
+     * @param line The line number, starting at 1
+     * @return the line of the source code, without its line break
      */
-    std::string getLine(size_t line, size_t currentCursorLine = 0, bool resetToHead = true);
+    std::string_view getLine(size_t line) const;
 
 private:
-    std::string mFileName;
-    std::ifstream mInputStream;
+    SourceFile::Ptr mSourceFile;
 };
 
 } // namespace caramel::utils
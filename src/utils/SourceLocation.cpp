@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (c) 2018 Kalate Hexanome, 4IF, INSA Lyon
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,28 +22,24 @@
  * SOFTWARE.
 */
 
-#include "PostfixOperatorIndex.h"
-#include "PostIncOperator.h"
-#include "PostDecrOperator.h"
+#include "SourceLocation.h"
 
-#define BIND(op) index.insert(make_pair(op::SYMBOL, dynamic_pointer_cast<UnaryOperator>(make_shared<op>())))
+#include <Token.h>
 
-using namespace std;
 
-caramel::ast::PostfixOperatorIndex::PostfixOperatorIndex() {
+namespace caramel::utils {
 
-    // Insert operators binding here...
-    BIND(PostIncOperator);
-    BIND(PostDecrOperator);
+SourceLocation::SourceLocation(antlr4::ParserRuleContext *antlrContext) {
+    auto const start = antlrContext->getStart();
+    auto stop = antlrContext->getStop();
+    if (nullptr == stop || stop->getStopIndex() < start->getStartIndex()) {
+        stop = start;
+    }
 
+    line = start->getLine();
+    column = start->getCharPositionInLine();
+    stopLine = stop->getLine();
+    stopColumn = stop->getCharPositionInLine() + stop->getStopIndex() - stop->getStartIndex() + 1;
 }
 
-caramel::ast::UnaryOperator::Ptr caramel::ast::PostfixOperatorIndex::getOpForToken(std::string token) {
-    auto it = index.find(token);
-
-    if (it == index.end()) {
-        return nullptr;
-    }
-
-    return it->second;
-}
\ No newline at end of file
+} // namespace caramel::utils
@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include <ParserRuleContext.h>
+
+#include <cstddef>
+
+
+namespace caramel::utils {
+
+/**
+ * The span of a construct in the source, copied out of its tokens.
+ * Unlike the rule context it comes from, it stays valid once the syntax tree is freed.
+ */
+struct SourceLocation {
+    SourceLocation() = default;
+
+    /// The span from the start of the first token of the context to the end of its last one.
+    explicit SourceLocation(antlr4::ParserRuleContext *antlrContext);
+
+    size_t line = 0;
+    size_t column = 0;
+    size_t stopLine = 0;
+    /// One past the last character of the span on the stop line
+    size_t stopColumn = 0;
+};
+
+} // namespace caramel::utils
@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "StringInterner.h"
+
+namespace caramel::utils {
+
+StringInterner::StringInterner()
+        : mTables{},
+          mTable{nullptr} {
+    mTables.push_back(std::make_unique<Table>(64));
+    mTable.store(mTables.back().get(), std::memory_order_release);
+}
+
+StringInterner::Table::Table(size_t capacity)
+        : mask{capacity - 1},
+          slots{std::make_unique<std::atomic<Entry const *>[]>(capacity)} {
+    for (size_t i = 0; i < capacity; ++i) {
+        slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+SymbolId StringInterner::intern(std::string_view string) {
+    size_t const hash = std::hash<std::string_view>{}(string);
+    if (auto id = find(*mTable.load(std::memory_order_acquire), string, hash)) {
+        return *id;
+    }
+
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    // Another thread may have interned it in the meantime
+    Table *table = mTable.load(std::memory_order_relaxed);
+    if (auto id = find(*table, string, hash)) {
+        return *id;
+    }
+
+    // Grown at half load, so the probes always end on an empty slot
+    if (2 * (mEntries.size() + 1) > table->mask + 1) {
+        mTables.push_back(std::make_unique<Table>(2 * (table->mask + 1)));
+        for (auto const &entry : mEntries) {
+            insert(*mTables.back(), &entry);
+        }
+        table = mTables.back().get();
+        mTable.store(table, std::memory_order_release);
+    }
+
+    auto const id = SymbolId(mEntries.size());
+    mEntries.push_back({std::string{string}, hash, id});
+    insert(*table, &mEntries.back());
+    return id;
+}
+
+std::optional<SymbolId> StringInterner::find(std::string_view string) const {
+    return find(*mTable.load(std::memory_order_acquire), string, std::hash<std::string_view>{}(string));
+}
+
+std::optional<SymbolId> StringInterner::find(Table const &table, std::string_view string, size_t hash) const {
+    for (size_t i = hash & table.mask;; i = (i + 1) & table.mask) {
+        Entry const *entry = table.slots[i].load(std::memory_order_acquire);
+        if (!entry) {
+            return std::nullopt;
+        }
+        if (entry->hash == hash && entry->string == string) {
+            return entry->id;
+        }
+    }
+}
+
+void StringInterner::insert(Table &table, Entry const *entry) {
+    size_t i = entry->hash & table.mask;
+    while (table.slots[i].load(std::memory_order_relaxed)) {
+        i = (i + 1) & table.mask;
+    }
+    table.slots[i].store(entry, std::memory_order_release);
+}
+
+std::string const &StringInterner::getString(SymbolId id) const {
+    std::lock_guard<std::mutex> lock{mMutex};
+    return mEntries.at(id).string;
+}
+
+size_t StringInterner::size() const {
+    std::lock_guard<std::mutex> lock{mMutex};
+    return mEntries.size();
+}
+
+StringInterner &StringInterner::global() {
+    static StringInterner interner;
+    return interner;
+}
+
+} // namespace caramel::utils
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 insa.4if.hexanome_kalate
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace caramel::utils {
+
+/**
+ * Compact identifier of an interned string.
+ */
+using SymbolId = uint32_t;
+
+/**
+ * Maps each distinct string to a SymbolId, and back.
+ * The interned strings live as long as the interner.
+ *
+ * Lookups probe an open-addressing table without taking the lock. Only the insertions
+ * are serialized; they publish the entries, and the grown tables, with release stores.
+ * The tables replaced by a growth are kept until the end, as a reader may still probe them.
+ */
+class StringInterner {
+public:
+    StringInterner();
+    ~StringInterner() = default;
+
+    StringInterner(StringInterner const &) = delete;
+    StringInterner &operator=(StringInterner const &) = delete;
+
+    SymbolId intern(std::string_view string);
+
+    /// Returns the id of an interned string, without interning it.
+    std::optional<SymbolId> find(std::string_view string) const;
+
+    std::string const &getString(SymbolId id) const;
+
+    size_t size() const;
+
+    /**
+     * The interner shared by the whole compilation.
+     */
+    static StringInterner &global();
+
+private:
+    struct Entry {
+        std::string string;
+        size_t hash;
+        SymbolId id;
+    };
+
+    struct Table {
+        explicit Table(size_t capacity);
+
+        size_t mask;
+        std::unique_ptr<std::atomic<Entry const *>[]> slots;
+    };
+
+    std::optional<SymbolId> find(Table const &table, std::string_view string, size_t hash) const;
+    static void insert(Table &table, Entry const *entry);
+
+    std::deque<Entry> mEntries;
+    std::vector<std::unique_ptr<Table>> mTables;
+    std::atomic<Table *> mTable;
+    mutable std::mutex mMutex;
+};
+
+inline SymbolId intern(std::string_view string) {
+    return StringInterner::global().intern(string);
+}
+
+inline std::optional<SymbolId> findInterned(std::string_view string) {
+    return StringInterner::global().find(string);
+}
+
+inline std::string const &internedString(SymbolId id) {
+    return StringInterner::global().getString(id);
+}
+
+} // namespace caramel::utils
@@ -25,6 +25,7 @@
 #include "ASTVisitor.h"
 #include "../Logger.h"
 #include "../utils/Common.h"
+#include "../ast/context/Prelude.h"
 #include "../ast/statements/jumps/Jump.h"
 #include "../ast/statements/jumps/BreakStatement.h"
 #include "../ast/statements/jumps/ReturnStatement.h"
@@ -40,97 +41,88 @@ using namespace caramel::utils;
 using namespace caramel::colors;
 using namespace caramel::visitors;
 
-ASTVisitor::ASTVisitor(std::string const &sourceFileName)
-        : mSourceFilename{sourceFileName} {
+// The brewed grammar inlines the operators, so they only have the T__N types of their literals
+ASTVisitor::ASTVisitor(utils::Diagnostics::Ptr diagnostics, antlr4::dfa::Vocabulary const &vocabulary)
+        : mDiagnostics{std::move(diagnostics)},
+          mBinaryOperatorIndex{vocabulary, {
+                  bindBinaryOperator<PlusOperator>("'+'"),
+                  bindBinaryOperator<MinusOperator>("'-'"),
+                  bindBinaryOperator<MultOperator>("'*'"),
+                  bindBinaryOperator<DivOperator>("'/'"),
+                  bindBinaryOperator<ModOperator>("'%'"),
+                  bindBinaryOperator<RightShiftOperator>("'>>'"),
+                  bindBinaryOperator<LeftShiftOperator>("'<<'"),
+                  bindBinaryOperator<LowerThanOperator>("'<'"),
+                  bindBinaryOperator<LowerEqThanOperator>("'<='"),
+                  bindBinaryOperator<GreaterThanOperator>("'>'"),
+                  bindBinaryOperator<GreaterEqThanOperator>("'>='"),
+                  bindBinaryOperator<EqualityOperator>("'=='"),
+                  bindBinaryOperator<NotEqOperator>("'!='"),
+                  bindBinaryOperator<BitwiseAndOperator>("'&'"),
+                  bindBinaryOperator<BitwiseXorOperator>("'^'"),
+                  bindBinaryOperator<BitwiseOrOperator>("'|'"),
+                  bindBinaryOperator<ConjunctionOperator>("'&&'"),
+                  bindBinaryOperator<DisjunctionOperator>("'||'"),
+                  bindBinaryOperator<AssignmentOperator>("'='"),
+                  bindBinaryOperator<PlusAssignmentOperator>("'+='"),
+                  bindBinaryOperator<MinusAssignmentOperator>("'-='"),
+                  bindBinaryOperator<TimesAssignmentOperator>("'*='"),
+                  bindBinaryOperator<DivAssignmentOperator>("'/='"),
+                  bindBinaryOperator<ModAssignmentOperator>("'%='"),
+                  bindBinaryOperator<BitwiseAndAssignmentOperator>("'&='"),
+                  bindBinaryOperator<BitwiseOrAssignmentOperator>("'|='"),
+                  bindBinaryOperator<BitwiseXorAssignmentOperator>("'^='"),
+                  bindBinaryOperator<LeftShiftAssignmentOperator>("'<<='"),
+                  bindBinaryOperator<RightShiftAssignmentOperator>("'>>='")
+          }},
+          mPrefixOperatorIndex{vocabulary, {
+                  bindPrefixOperator<PreIncrOperator>("'++'"),
+                  bindPrefixOperator<PreDecrOperator>("'--'"),
+                  bindPrefixOperator<LogicalNotOperator>("'!'"),
+                  bindPrefixOperator<PreNegOperator>("'-'")
+          }},
+          mPostfixOperatorIndex{vocabulary, {
+                  bindPostfixOperator<PostIncOperator>("'++'"),
+                  bindPostfixOperator<PostDecrOperator>("'--'")
+          }} {
 }
 
-antlrcpp::Any ASTVisitor::visitR(CaramelParser::RContext *ctx) {
-    logger.trace() << "Visiting R: " << grey << ctx->getText();
+Context::Ptr ASTVisitor::visitR(CaramelParser::RContext *ctx) {
+    CARAMEL_TRACE << "Visiting R: " << grey << ctx->getText();
 
     ContextPusher contextPusher(*this);
     Context::Ptr context = contextPusher.getContext();
 
-    SymbolTable::Ptr symbolTable = context->getSymbolTable();
-
-    // Add types
-    logger.debug() << "Adding primary types.";
-    PrimaryType::Ptr void_t = Void_t::Create();
-    PrimaryType::Ptr char_t = Char::Create();
-    PrimaryType::Ptr int8_t = Int8_t::Create();
-    PrimaryType::Ptr int16_t = Int16_t::Create();
-    PrimaryType::Ptr int32_t = Int32_t::Create();
-    PrimaryType::Ptr int64_t = Int64_t::Create();
-
-    symbolTable->addPrimaryType(void_t, void_t->getIdentifier());
-    symbolTable->addPrimaryType(char_t, char_t->getIdentifier());
-    symbolTable->addPrimaryType(int8_t, int8_t->getIdentifier());
-    symbolTable->addPrimaryType(int16_t, int16_t->getIdentifier());
-    symbolTable->addPrimaryType(int32_t, int32_t->getIdentifier());
-    symbolTable->addPrimaryType(int64_t, int64_t->getIdentifier());
-
-    // Add prelude functions
-    // puts
-    logger.debug() << "Adding prelude functions.";
-    // TODO: Declare puts in prelude when constString_t will be handled
-//    auto putsDecl = std::make_shared<FunctionDeclaration>(ctx->getStart());
-//    std::vector<FunctionParameterSignature> putsParams = {
-//            {"c", char_t, SymbolType::VariableSymbol}
-//    };
-//    auto putsSymbol = symbolTable->addFunctionDeclaration(ctx, void_t, "puts", putsParams, putsDecl);
-//    putsDecl->setFunctionSymbol(putsSymbol);
-    // printf
-    auto printfDecl = std::make_shared<FunctionDeclaration>(ctx->getStart());
-    std::vector<FunctionParameterSignature> printfParams = {};
-    auto printfSymbol = symbolTable->addFunctionDeclaration(ctx, void_t, "printf", printfParams, printfDecl, true);
-    printfDecl->setFunctionSymbol(printfSymbol);
-    // putchar
-    auto putcharDecl = std::make_shared<FunctionDeclaration>(ctx->getStart());
-    std::vector<FunctionParameterSignature> putcharParams = {
-            {"c", int32_t, SymbolType::VariableSymbol}
-    };
-    auto putcharSymbol = symbolTable->addFunctionDeclaration(ctx, void_t, "putchar", putcharParams, putcharDecl);
-    putcharDecl->setFunctionSymbol(putcharSymbol);
-    // getchar
-    auto getcharDecl = std::make_shared<FunctionDeclaration>(ctx->getStart());
-    std::vector<FunctionParameterSignature> getcharParams = {};
-    auto getcharSymbol = symbolTable->addFunctionDeclaration(ctx, int32_t, "getchar", getcharParams, getcharDecl);
-    getcharDecl->setFunctionSymbol(getcharSymbol);
-    // exit
-    auto exitDecl = std::make_shared<FunctionDeclaration>(ctx->getStart());
-    std::vector<FunctionParameterSignature> exitParams = {
-            {"code", int32_t, SymbolType::VariableSymbol}
-    };
-    auto exitSymbol = symbolTable->addFunctionDeclaration(ctx, void_t, "exit", exitParams, exitDecl);
-    exitDecl->setFunctionSymbol(exitSymbol);
+    std::vector<Declaration::Ptr> preludeDeclarations = declarePrelude(context, ctx);
 
     try {context->addStatements(visitStatements(ctx->statements()));}
     catch(caramel::exceptions::SemanticError &semanticError){
-        incrementErrorCount();
-        semanticError.explain(utils::SourceFileUtil(mSourceFilename));
+        mDiagnostics->semanticError(semanticError);
     }
     return context;
 }
 
-antlrcpp::Any ASTVisitor::visitStatements(CaramelParser::StatementsContext *ctx) {
-    logger.trace() << "visiting statements: " << grey <<ctx->getText();
+std::vector<Statement::Ptr> ASTVisitor::visitStatements(CaramelParser::StatementsContext *ctx) {
+    CARAMEL_TRACE << "visiting statements: " << grey <<ctx->getText();
 
     std::vector<Statement::Ptr> statements;
     for (auto statement : ctx->statement()) {
-        logger.trace() << "[statements] visiting statement: " << grey << statement->getText();
+        CARAMEL_TRACE << "[statements] visiting statement: " << grey << statement->getText();
 
-        antlrcpp::Any r;
-        try {r = visitStatement(statement);}
+        bool handled = false;
+        try {
+            // A lone separator is an empty statement
+            if (!statement->InstructionSeparator()) {
+                std::vector<Statement::Ptr> r = visitStatement(statement);
+                std::move(r.begin(), r.end(), std::back_inserter(statements));
+                handled = true;
+            }
+        }
         catch(caramel::exceptions::SemanticError &semanticError){
-            incrementErrorCount();
-            semanticError.explain(utils::SourceFileUtil(mSourceFilename));
+            mDiagnostics->semanticError(semanticError);
         }
-        if (r.is<Statement::Ptr>()) {
-            statements.push_back(r.as<Statement::Ptr>());
-            logger.debug() << green << "Yay statement:\n" << statement->getText();
-        } else if (r.is<std::vector<Statement::Ptr>>()) {
-            auto statementVector = r.as<std::vector<Statement::Ptr>>();
-            std::copy(statementVector.begin(), statementVector.end(), std::back_inserter(statements));
-            logger.debug() << green << "Yay statement:\n" << statement->getText();
+        if (handled) {
+            CARAMEL_DEBUG << green << "Yay statement:\n" << statement->getText();
         } else {
             logger.warning() << "Skipping unhandled statement:\n" << statement->getText();
         }
@@ -138,20 +130,29 @@ antlrcpp::Any ASTVisitor::visitStatements(CaramelParser::StatementsContext *ctx)
     return statements;
 }
 
-antlrcpp::Any ASTVisitor::visitBlock(CaramelParser::BlockContext *ctx) {
-    logger.trace() << "visiting block: " << grey <<ctx->getText();
+std::vector<Statement::Ptr> ASTVisitor::visitStatement(CaramelParser::StatementContext *ctx) {
+    CARAMEL_TRACE << "visiting statement: " << grey <<ctx->getText();
+
+    if (ctx->instruction()) {
+        return {visitInstruction(ctx->instruction())};
+    } else if (ctx->declaration()) {
+        return visitDeclaration(ctx->declaration());
+    }
+    return {};
+}
+
+std::vector<Statement::Ptr> ASTVisitor::visitBlock(CaramelParser::BlockContext *ctx) {
+    CARAMEL_TRACE << "visiting block: " << grey <<ctx->getText();
 
     std::vector<Statement::Ptr> returnStatements;
 
     if (ctx->declarations()) {
         std::vector<Statement::Ptr> declarations;
         try {
-            std::vector<Statement::Ptr> r = visitDeclarations( ctx->declarations() );
-            declarations = std::move(r); // TODO: Workaround
+            declarations = visitDeclarations(ctx->declarations());
         }
         catch(caramel::exceptions::SemanticError &semanticError){
-            incrementErrorCount();
-            semanticError.explain(utils::SourceFileUtil(mSourceFilename));
+            mDiagnostics->semanticError(semanticError);
         }
         //currentContext()->addStatements(std::move(declarations));
         std::move(declarations.begin(),declarations.end(),std::back_inserter(returnStatements));
@@ -159,12 +160,10 @@ antlrcpp::Any ASTVisitor::visitBlock(CaramelParser::BlockContext *ctx) {
     if (ctx->instructions()) {
         std::vector<Statement::Ptr> instructions;
         try {
-            std::vector<Statement::Ptr> i = visitInstructions(ctx->instructions());
-            instructions = std::move(i); // TODO: Workaround
+            instructions = visitInstructions(ctx->instructions());
         }
         catch(caramel::exceptions::SemanticError &semanticError){
-            incrementErrorCount();
-            semanticError.explain(utils::SourceFileUtil(mSourceFilename));
+            mDiagnostics->semanticError(semanticError);
         }
         //currentContext()->addStatements(std::move(instructions));
         std::move(instructions.begin(),instructions.end(),std::back_inserter(returnStatements));
@@ -173,31 +172,52 @@ antlrcpp::Any ASTVisitor::visitBlock(CaramelParser::BlockContext *ctx) {
     return returnStatements;
 }
 
-antlrcpp::Any ASTVisitor::visitDeclarations(CaramelParser::DeclarationsContext *ctx) {
-    logger.trace() << "visiting declarations: " << grey <<ctx->getText();
+std::vector<Statement::Ptr> ASTVisitor::visitDeclarations(CaramelParser::DeclarationsContext *ctx) {
+    CARAMEL_TRACE << "visiting declarations: " << grey <<ctx->getText();
 
     std::vector<Statement::Ptr> declarations;
     for (auto declaration : ctx->declaration()) {
-        antlrcpp::Any r;
-        try {r = visitDeclaration(declaration);}
+        bool handled = false;
+        try {
+            std::vector<Statement::Ptr> r = visitDeclaration(declaration);
+            std::move(r.begin(), r.end(), std::back_inserter(declarations));
+            handled = true;
+        }
         catch(caramel::exceptions::SemanticError &semanticError){
-            incrementErrorCount();
-            semanticError.explain(utils::SourceFileUtil(mSourceFilename));
+            mDiagnostics->semanticError(semanticError);
         }
-        if (r.is<Statement::Ptr>()) {
-            declarations.push_back(r.as<Statement::Ptr>());
-        } else if (r.is<std::vector<Statement::Ptr>>()) {
-            auto declarationVector = r.as<std::vector<Statement::Ptr>>();
-            std::move(declarationVector.begin(), declarationVector.end(), std::back_inserter(declarations));
-        } else {
+        if (!handled) {
             logger.warning() << "Skipping unhandled declaration:\n" << declaration->getText();
         }
     }
     return declarations;
 }
 
-antlrcpp::Any ASTVisitor::visitInstructions(CaramelParser::InstructionsContext *ctx) {
-    logger.trace() << "visiting instructions: " << grey <<ctx->getText();
+std::vector<Statement::Ptr> ASTVisitor::visitDeclaration(CaramelParser::DeclarationContext *ctx) {
+    CARAMEL_TRACE << "visiting declaration: " << grey <<ctx->getText();
+
+    if (ctx->typeDefinition()) {
+        return {visitTypeDefinition(ctx->typeDefinition())};
+    } else if (ctx->functionDefinition()) {
+        return {visitFunctionDefinition(ctx->functionDefinition())};
+    } else if (ctx->functionDeclaration()) {
+        return {visitFunctionDeclaration(ctx->functionDeclaration())};
+    } else if (ctx->arrayDeclaration()) {
+        return {visitArrayDeclaration(ctx->arrayDeclaration())};
+    } else if (ctx->arrayDefinition()) {
+        return {visitArrayDefinition(ctx->arrayDefinition())};
+    } else if (ctx->variableDeclaration()) {
+        return visitVariableDeclaration(ctx->variableDeclaration());
+    } else if (ctx->variableDefinition()) {
+        return visitVariableDefinition(ctx->variableDefinition());
+    } else {
+        logger.fatal() << "The grammar has changed.";
+        exit(1);
+    }
+}
+
+std::vector<Statement::Ptr> ASTVisitor::visitInstructions(CaramelParser::InstructionsContext *ctx) {
+    CARAMEL_TRACE << "visiting instructions: " << grey <<ctx->getText();
 
     std::vector<Statement::Ptr> instructions;
     for (auto instructionCtx : ctx->instruction()) {
@@ -207,65 +227,77 @@ antlrcpp::Any ASTVisitor::visitInstructions(CaramelParser::InstructionsContext *
     return instructions;
 }
 
-antlrcpp::Any ASTVisitor::visitValidIdentifier(CaramelParser::ValidIdentifierContext *ctx) {
-    logger.trace() << "visiting valid identifier: " << grey << ctx->getText();
+std::string ASTVisitor::visitValidIdentifier(CaramelParser::ValidIdentifierContext *ctx) {
+    CARAMEL_TRACE << "visiting valid identifier: " << grey << ctx->getText();
     return ctx->getText();
 }
 
-antlrcpp::Any
+TypeSymbol::Ptr
 ASTVisitor::visitTypeParameter(CaramelParser::TypeParameterContext *ctx) {
-    logger.trace() << "visiting type parameter: " << grey << ctx->getText();
+    CARAMEL_TRACE << "visiting type parameter: " << grey << ctx->getText();
 
     std::string symbolName = ctx->getText();
     if (currentContext()->getSymbolTable()->hasSymbol(symbolName)) {
         Symbol::Ptr symbol = currentContext()->getSymbolTable()->getSymbol(ctx, symbolName);
-        return castTo<TypeSymbol::Ptr>(symbol);
+        if (symbol->getSymbolType() != SymbolType::TypeSymbol) {
+            return nullptr;
+        }
+        return std::static_pointer_cast<TypeSymbol>(symbol);
     } else {
         throw std::runtime_error("Default symbol " + symbolName + " is created with void_t as return type");
     }
 }
 
-antlrcpp::Any ASTVisitor::visitInstruction(CaramelParser::InstructionContext *ctx) {
-    logger.trace() << "visiting instruction: " << grey <<ctx->getText();
+Statement::Ptr ASTVisitor::visitInstruction(CaramelParser::InstructionContext *ctx) {
+    CARAMEL_TRACE << "visiting instruction: " << grey <<ctx->getText();
 
     if (ctx->jump()) {
-        return castAnyTo<Jump::Ptr, Statement::Ptr>(visitJump(ctx->jump()));
+        return visitJump(ctx->jump());
     } else if (ctx->controlBlock()) {
-        return castAnyTo<ControlBlock::Ptr, Statement::Ptr>(visitControlBlock(ctx->controlBlock()));
+        return visitControlBlock(ctx->controlBlock());
     }
 
-    return castAnyTo<Expression::Ptr, Statement::Ptr>(visitExpression(ctx->expression()));
+    return visitExpression(ctx->expression());
 }
 
-antlrcpp::Any ASTVisitor::visitTypeDefinition(CaramelParser::TypeDefinitionContext *ctx) {
-    logger.trace() << "visiting type definition: " << grey <<ctx->getText();
+Statement::Ptr ASTVisitor::visitTypeDefinition(CaramelParser::TypeDefinitionContext *ctx) {
+    CARAMEL_TRACE << "visiting type definition: " << grey <<ctx->getText();
 
     TypeSymbol::Ptr primaryTypeSymbol = visitTypeParameter(ctx->typeParameter()[0]);
     TypeSymbol::Ptr typeAliasDefault = visitTypeParameter(ctx->typeParameter()[1]);
 
-    TypeDefinition::Ptr typeDefinition = std::make_shared<TypeDefinition>(
+    TypeDefinition::Ptr typeDefinition = makeNode<TypeDefinition>(
             ctx->getStart(), typeAliasDefault->getName(), primaryTypeSymbol);
     currentContext()->getSymbolTable()->addType(ctx, typeDefinition);
 
-    return castTo<Statement::Ptr>(typeDefinition);
+    return typeDefinition;
 }
 
-antlrcpp::Any ASTVisitor::visitReturnJump(CaramelParser::ReturnJumpContext *ctx) {
-    logger.trace() << "visiting return jump: " << grey <<ctx->getText();
+Jump::Ptr ASTVisitor::visitJump(CaramelParser::JumpContext *ctx) {
+    CARAMEL_TRACE << "visiting jump: " << grey <<ctx->getText();
+
+    if (ctx->breakJump()) {
+        return visitBreakJump(ctx->breakJump());
+    }
+    return visitReturnJump(ctx->returnJump());
+}
+
+Jump::Ptr ASTVisitor::visitReturnJump(CaramelParser::ReturnJumpContext *ctx) {
+    CARAMEL_TRACE << "visiting return jump: " << grey <<ctx->getText();
 
     // Fixme : return true value
     if (ctx->expression()) {
         Expression::Ptr returnedExpression = visitExpression(ctx->expression());
-        return castTo<Jump::Ptr>(std::make_shared<ReturnStatement>(returnedExpression, ctx->getStart()));
+        return makeNode<ReturnStatement>(returnedExpression, ctx->getStart());
     } else {
-        return castTo<Jump::Ptr>(std::make_shared<ReturnStatement>(ctx->getStart()));
+        return makeNode<ReturnStatement>(ctx->getStart());
     }
 }
 
-antlrcpp::Any ASTVisitor::visitBreakJump(CaramelParser::BreakJumpContext *ctx) {
-    logger.trace() << "visiting break jump: " << grey <<ctx->getText();
+Jump::Ptr ASTVisitor::visitBreakJump(CaramelParser::BreakJumpContext *ctx) {
+    CARAMEL_TRACE << "visiting break jump: " << grey <<ctx->getText();
 
-    return castTo<Jump::Ptr>(std::make_shared<BreakStatement>(ctx->getStart()));
+    return makeNode<BreakStatement>(ctx->getStart());
 }
 
 std::shared_ptr<Context> ASTVisitor::rootContext() {
@@ -280,36 +312,15 @@ std::shared_ptr<Context> ASTVisitor::currentContext() {
     return mContextStack.top();
 }
 
-antlrcpp::Any ASTVisitor::visitChildren(antlr4::tree::ParseTree *node) {
-    size_t n = node->children.size();
-    size_t i = 0;
-    while (i < n && nullptr == node->children[i]) { i++; }
-    antlrcpp::Any childResult;
-    if (i < n) {
-        childResult = node->children[i]->accept(this);
-    } else {
-        childResult = defaultResult();
-    }
-    return childResult;
-}
-
-void ASTVisitor::incrementErrorCount(){
-    mErrorCount++;
-}
-
-int ASTVisitor::getErrorCount(){
-    return mErrorCount;
-}
-
 ContextPusher::ContextPusher(ASTVisitor &ASTVisitor)
         : mASTVisitor(ASTVisitor) {
     logger.trace() << "ContextPusher: Trying to push a new context.";
 
     auto &contextStack = mASTVisitor.mContextStack;
     if (not contextStack.empty()) {
-        contextStack.push(std::make_shared<Context>(contextStack.top()));
+        contextStack.push(makeNode<Context>(contextStack.top()));
     } else {
-        contextStack.push(std::make_shared<Context>());
+        contextStack.push(makeNode<Context>());
     }
 
     logger.debug() << "Pushed a new context.";
@@ -319,6 +330,7 @@ ContextPusher::~ContextPusher() {
     logger.trace() << "Popping context: " << *mASTVisitor.mContextStack.top();
     verifUsageStatic(mASTVisitor.mContextStack.top());
     logger.debug() << "Popped context: " << *mASTVisitor.mContextStack.top();
+    mASTVisitor.mContextStack.top()->getSymbolTable()->exitScope();
     mASTVisitor.mContextStack.pop();
 }
 
@@ -326,11 +338,12 @@ Context::Ptr ContextPusher::getContext() {
     return mASTVisitor.currentContext();
 }
 
-void ContextPusher::verifUsageStatic(ast::Context::Ptr context) {
-    logger.trace() << "Running static analysis on: " << *mASTVisitor.mContextStack.top();
+void ContextPusher::verifUsageStatic(ast::Context::Ptr const &context) {
+    logger.trace() << "Running static analysis on: " << *context;
 
     auto symbolTable = context->getSymbolTable();
-    for (auto &[name, symbol] : symbolTable->getSymbols()) {
+    for (auto &[id, symbol] : symbolTable->getSymbols()) {
+        std::string const &name = internedString(id);
         if (name.length() >= 2 && name[0] == '_' && name[1] == '_') continue;
 
         if (symbolTable->isDeclared(name)) {
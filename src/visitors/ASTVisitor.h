@@ -26,13 +26,25 @@
 
 #include "../utils/Common.h"
 #include "../Console.h"
-#include "../utils/SourceFileUtil.h"
+#include "../utils/Diagnostics.h"
 #include "../ast/context/Context.h"
+#include "../ast/statements/jumps/Jump.h"
+#include "../ast/statements/expressions/atomicexpression/Constant.h"
+#include "../ast/statements/controlblocks/IfBlock.h"
+#include "../ast/statements/controlblocks/ForBlock.h"
+#include "../ast/statements/controlblocks/WhileBlock.h"
+#include "../ast/statements/controlblocks/Do_WhileBlock.h"
+#include "../ast/statements/declaration/FunctionDeclaration.h"
+#include "../ast/statements/definition/FunctionDefinition.h"
+#include "../ast/statements/declaration/ArrayDeclaration.h"
+#include "../ast/statements/definition/ArrayDefinition.h"
+#include "../ast/operators/BinaryOperator.h"
+#include "../ast/operators/UnaryOperator.h"
 #include "../ast/operators/binaryoperators/BinaryOperatorIndex.h"
 #include "../ast/operators/prefixoperators/PrefixOperatorIndex.h"
 #include "../ast/operators/postfixoperators/PostfixOperatorIndex.h"
 
-#include <CaramelBaseVisitor.h>
+#include <CaramelParser.h>
 
 #include <stdexcept>
 #include <iostream>
@@ -41,204 +53,127 @@ namespace caramel::visitors {
 
 class ContextPusher;
 
-class ASTVisitor : public CaramelBaseVisitor {
+/// Walks the ANTLR parse tree and builds the AST.
+/// Every rule has its own method with the type it produces, so no node goes through antlrcpp::Any.
+class ASTVisitor {
 
 public:
-    explicit ASTVisitor(std::string const &sourceFileName);
+    /// The operators are bound to the token types of the parser's vocabulary.
+    ASTVisitor(utils::Diagnostics::Ptr diagnostics, antlr4::dfa::Vocabulary const &vocabulary);
 
-    antlrcpp::Any visitR(CaramelParser::RContext *ctx) override;
+    ast::Context::Ptr visitR(CaramelParser::RContext *ctx);
 
-    /// Returns vector<Statement::Ptr>
-    antlrcpp::Any visitStatements(CaramelParser::StatementsContext *ctx) override;
+    std::vector<ast::Statement::Ptr> visitStatements(CaramelParser::StatementsContext *ctx);
 
-    /// Returns vector<Statement::Ptr>
-    antlrcpp::Any visitBlock(CaramelParser::BlockContext *ctx) override;
+    /// A declaration can produce several statements (int a, b;), hence the vector.
+    std::vector<ast::Statement::Ptr> visitStatement(CaramelParser::StatementContext *ctx);
 
-    /// Returns vector<Statement::Ptr>
-    antlrcpp::Any visitDeclarations(CaramelParser::DeclarationsContext *ctx) override;
+    std::vector<ast::Statement::Ptr> visitBlock(CaramelParser::BlockContext *ctx);
 
-    /// Returns vector<Statement::Ptr>
-    antlrcpp::Any visitInstructions(CaramelParser::InstructionsContext *ctx) override;
+    std::vector<ast::Statement::Ptr> visitDeclarations(CaramelParser::DeclarationsContext *ctx);
 
-    /// Returns std::string
-    antlrcpp::Any visitValidIdentifier(CaramelParser::ValidIdentifierContext *ctx) override;
+    std::vector<ast::Statement::Ptr> visitDeclaration(CaramelParser::DeclarationContext *ctx);
 
-    /// Returns SymbolType::Ptr (in a Symbol::Ptr)
-    antlrcpp::Any visitTypeParameter(CaramelParser::TypeParameterContext *ctx) override;
+    std::vector<ast::Statement::Ptr> visitInstructions(CaramelParser::InstructionsContext *ctx);
 
-    /// Returns Statement::Ptr
-    antlrcpp::Any visitInstruction(CaramelParser::InstructionContext *ctx) override;
+    std::string visitValidIdentifier(CaramelParser::ValidIdentifierContext *ctx);
 
-    /// Returns Statement::Ptr
-    antlrcpp::Any visitTypeDefinition(CaramelParser::TypeDefinitionContext *ctx) override;
+    ast::TypeSymbol::Ptr visitTypeParameter(CaramelParser::TypeParameterContext *ctx);
 
-    /// Returns Jump::Ptr
-    antlrcpp::Any visitReturnJump(CaramelParser::ReturnJumpContext *ctx) override;
+    ast::Statement::Ptr visitInstruction(CaramelParser::InstructionContext *ctx);
 
-    /// Returns Jump::Ptr
-    antlrcpp::Any visitBreakJump(CaramelParser::BreakJumpContext *ctx) override;
+    ast::Statement::Ptr visitTypeDefinition(CaramelParser::TypeDefinitionContext *ctx);
+
+    ast::Jump::Ptr visitJump(CaramelParser::JumpContext *ctx);
+
+    ast::Jump::Ptr visitReturnJump(CaramelParser::ReturnJumpContext *ctx);
+
+    ast::Jump::Ptr visitBreakJump(CaramelParser::BreakJumpContext *ctx);
 
     //--------------------------------------------------------------------------------------------------------
     // Variables
 
-    /// Returns vector<Statement::Ptr>
-    antlrcpp::Any visitVariableDeclaration(CaramelParser::VariableDeclarationContext *ctx) override;
+    std::vector<ast::Statement::Ptr> visitVariableDeclaration(CaramelParser::VariableDeclarationContext *ctx);
 
-    /// Returns vector<Statement::Ptr>
-    antlrcpp::Any visitVariableDefinition(CaramelParser::VariableDefinitionContext *ctx) override;
+    std::vector<ast::Statement::Ptr> visitVariableDefinition(CaramelParser::VariableDefinitionContext *ctx);
 
     //--------------------------------------------------------------------------------------------------------
     // Functions
 
-    /// Returns Statement::Ptr
-    antlrcpp::Any visitFunctionDeclaration(CaramelParser::FunctionDeclarationContext *ctx) override;
+    ast::FunctionDeclaration::Ptr visitFunctionDeclaration(CaramelParser::FunctionDeclarationContext *ctx);
 
-    /// Returns Statement::Ptr
-    antlrcpp::Any visitFunctionDefinition(CaramelParser::FunctionDefinitionContext *ctx) override;
+    ast::FunctionDefinition::Ptr visitFunctionDefinition(CaramelParser::FunctionDefinitionContext *ctx);
 
-    /// Returns std::vector< visitFunctionArgument()::returnType >
-    antlrcpp::Any visitFunctionArguments(CaramelParser::FunctionArgumentsContext *ctx) override;
+    std::vector<ast::FunctionParameterSignature>
+    visitFunctionArguments(CaramelParser::FunctionArgumentsContext *ctx);
 
-    /// Returns FunctionParameterSignature
-    antlrcpp::Any visitFunctionArgument(CaramelParser::FunctionArgumentContext *ctx) override;
+    ast::FunctionParameterSignature visitFunctionArgument(CaramelParser::FunctionArgumentContext *ctx);
 
     //--------------------------------------------------------------------------------------------------------
     // Arrays
 
-    /// Returns Statement::Ptr
-    antlrcpp::Any visitArrayDeclaration(CaramelParser::ArrayDeclarationContext *ctx) override;
+    ast::ArrayDeclaration::Ptr visitArrayDeclaration(CaramelParser::ArrayDeclarationContext *ctx);
 
-    /// Returns Statement::Ptr
-    antlrcpp::Any visitArrayDefinition(CaramelParser::ArrayDefinitionContext *ctx) override;
+    ast::ArrayDefinition::Ptr visitArrayDefinition(CaramelParser::ArrayDefinitionContext *ctx);
 
-    /// Returns std::vector<Expression::Ptr>
-    antlrcpp::Any visitArrayBlock(CaramelParser::ArrayBlockContext *ctx) override;
+    std::vector<ast::Expression::Ptr> visitArrayBlock(CaramelParser::ArrayBlockContext *ctx);
 
     //--------------------------------------------------------------------------------------------------------
     // Expressions
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitExpression(CaramelParser::ExpressionContext *ctx) override;
-
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitAdditiveExpression(CaramelParser::AdditiveExpressionContext *ctx) override;
-
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitAtomicExpression(CaramelParser::AtomicExpressionContext *ctx) override;
-
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitComparison(CaramelParser::ComparisonContext *ctx) override;
-
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitEqualityComparison(CaramelParser::EqualityComparisonContext *ctx) override;
-
-    /// Returns AtomicExpression::Ptr
-    antlrcpp::Any visitNumberConstant(CaramelParser::NumberConstantContext *ctx) override;
-
-    /// Returns AtomicExpression::Ptr
-    antlrcpp::Any visitCharConstant(CaramelParser::CharConstantContext *ctx) override;
-
-    /// Returns AtomicExpression::Ptr
-    antlrcpp::Any visitPositiveConstant(CaramelParser::PositiveConstantContext *ctx) override;
-
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitPrefixUnaryExpression(CaramelParser::PrefixUnaryExpressionContext *ctx) override;
+    ast::Expression::Ptr visitExpression(CaramelParser::ExpressionContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitPostfixUnaryExpression(CaramelParser::PostfixUnaryExpressionContext *ctx) override;
+    ast::Expression::Ptr visitExpressionNoComma(CaramelParser::ExpressionNoCommaContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitBitwiseShiftExpression(CaramelParser::BitwiseShiftExpressionContext *ctx) override;
+    ast::Expression::Ptr visitAtomicExpression(CaramelParser::AtomicExpressionContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitMultiplicativeExpression(CaramelParser::MultiplicativeExpressionContext *ctx) override;
+    ast::Constant::Ptr visitNumberConstant(CaramelParser::NumberConstantContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitAndBitwiseExpression(CaramelParser::AndBitwiseExpressionContext *ctx) override;
+    ast::Constant::Ptr visitCharConstant(CaramelParser::CharConstantContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitOrBitwiseExpression(CaramelParser::OrBitwiseExpressionContext *ctx) override;
+    ast::Constant::Ptr visitPositiveConstant(CaramelParser::PositiveConstantContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitXorBitwiseExpression(CaramelParser::XorBitwiseExpressionContext *ctx) override;
+    ast::Expression::Ptr visitPrefixUnaryExpression(CaramelParser::PrefixUnaryExpressionContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitConjunction(CaramelParser::ConjunctionContext *ctx) override;
+    ast::Expression::Ptr visitPostfixUnaryExpression(CaramelParser::PostfixUnaryExpressionContext *ctx);
 
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitDisjunction(CaramelParser::DisjunctionContext *ctx) override;
-
-    /// Returns Expression::Ptr
-    antlrcpp::Any visitAssignment(CaramelParser::AssignmentContext *ctx) override;
-
-    /// Returns LValue::Ptr
-    antlrcpp::Any visitLvalue(CaramelParser::LvalueContext *ctx) override;
+    /// Returns an Identifier or an ArrayAccess
+    ast::Expression::Ptr visitLvalue(CaramelParser::LvalueContext *ctx);
 
     //--------------------------------------------------------------------------------------------------------
     // Operators
 
-    /// Returns BinaryOperator::Ptr
-    antlrcpp::Any visitMultiplicativeOperator(CaramelParser::MultiplicativeOperatorContext *ctx) override;
-
-    /// Returns BinaryOperator::Ptr
-    antlrcpp::Any visitBitwiseShiftOperator(CaramelParser::BitwiseShiftOperatorContext *ctx) override;
-
-    /// Returns BinaryOperator::Ptr
-    antlrcpp::Any visitComparativeOperator(CaramelParser::ComparativeOperatorContext *ctx) override;
-
-    /// Returns BinaryOperator::Ptr
-    antlrcpp::Any visitAdditiveOperator(CaramelParser::AdditiveOperatorContext *ctx) override;
-
-    /// Returns BinaryOperator::Ptr
-    antlrcpp::Any visitAssignmentOperator(CaramelParser::AssignmentOperatorContext *ctx) override;
+    ast::BinaryOperator::Ptr visitAssignmentOperator(CaramelParser::AssignmentOperatorContext *ctx);
 
-    /// Returns BinaryOperator::Ptr
-    antlrcpp::Any visitEqualityOperator(CaramelParser::EqualityOperatorContext *ctx) override;
+    ast::UnaryOperator::Ptr visitPostfixUnaryOperator(CaramelParser::PostfixUnaryOperatorContext *ctx);
 
-    /// Returns UnaryOperator::Ptr
-    antlrcpp::Any visitPostfixUnaryOperator(CaramelParser::PostfixUnaryOperatorContext *ctx) override;
-
-    /// Returns UnaryOperator::Ptr
-    antlrcpp::Any visitPrefixUnaryOperator(CaramelParser::PrefixUnaryOperatorContext *ctx) override;
+    ast::UnaryOperator::Ptr visitPrefixUnaryOperator(CaramelParser::PrefixUnaryOperatorContext *ctx);
 
     //--------------------------------------------------------------------------------------------------------
     // Control blocks
 
-    /// Returns ControlBlock::Ptr
-    antlrcpp::Any visitControlBlock(CaramelParser::ControlBlockContext *ctx) override;
+    ast::ControlBlock::Ptr visitControlBlock(CaramelParser::ControlBlockContext *ctx);
 
-    /// Returns IfBlock::Ptr
-    antlrcpp::Any visitIfBlock(CaramelParser::IfBlockContext *ctx) override;
+    ast::IfBlock::Ptr visitIfBlock(CaramelParser::IfBlockContext *ctx);
 
-    /// Returns ForBlock::Ptr
-    antlrcpp::Any visitForBlock(CaramelParser::ForBlockContext *ctx) override;
+    ast::ForBlock::Ptr visitForBlock(CaramelParser::ForBlockContext *ctx);
 
-    /// Returns WhileBlock::Ptr
-    antlrcpp::Any visitWhileBlock(CaramelParser::WhileBlockContext *ctx) override;
+    ast::WhileBlock::Ptr visitWhileBlock(CaramelParser::WhileBlockContext *ctx);
 
-    /// Returns DoWhileBlock::Ptr
-    antlrcpp::Any visitDoWhileBlock(CaramelParser::DoWhileBlockContext *ctx) override;
+    ast::Do_WhileBlock::Ptr visitDoWhileBlock(CaramelParser::DoWhileBlockContext *ctx);
 
 private:
     std::shared_ptr<ast::Context> rootContext(); //
     std::shared_ptr<ast::Context> currentContext(); //
     friend class ContextPusher;
 
-    antlrcpp::Any visitChildren(antlr4::tree::ParseTree *node) override;
-
-    void incrementErrorCount();
-
-public:
-    int getErrorCount();
-
 private:
     std::stack<std::shared_ptr<ast::Context>> mContextStack;
-    std::string mSourceFilename;
+    utils::Diagnostics::Ptr mDiagnostics;
 
-    ast::BinaryOperatorIndex mBinaryOperatorIndex;
-    ast::PrefixOperatorIndex mPrefixOperatorIndex;
-    ast::PostfixOperatorIndex mPostfixOperatorIndex;
-    int mErrorCount = 0;
+    ast::BinaryOperatorVocabulary mBinaryOperatorIndex;
+    ast::PrefixOperatorVocabulary mPrefixOperatorIndex;
+    ast::PostfixOperatorVocabulary mPostfixOperatorIndex;
 };
 
 class ContextPusher {
@@ -249,7 +184,7 @@ public:
     ast::Context::Ptr getContext();
 
     // TODO: Move to a proper class
-    void verifUsageStatic(ast::Context::Ptr context);
+    static void verifUsageStatic(ast::Context::Ptr const &context);
 
 private:
     ASTVisitor &mASTVisitor;
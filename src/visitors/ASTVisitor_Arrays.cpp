@@ -38,8 +38,8 @@ using namespace caramel::colors;
 using namespace caramel::visitors;
 using namespace caramel::exceptions;
 
-antlrcpp::Any ASTVisitor::visitArrayDeclaration(CaramelParser::ArrayDeclarationContext *ctx) {
-    logger.trace() << "visiting array declaration: " << grey <<ctx->getText();
+ArrayDeclaration::Ptr ASTVisitor::visitArrayDeclaration(CaramelParser::ArrayDeclarationContext *ctx) {
+    CARAMEL_TRACE << "visiting array declaration: " << grey <<ctx->getText();
 
     bool sized = ctx->arraySizedInner() != nullptr;
     size_t size = {};
@@ -48,25 +48,24 @@ antlrcpp::Any ASTVisitor::visitArrayDeclaration(CaramelParser::ArrayDeclarationC
     TypeSymbol::Ptr typeSymbol;
 
     if (sized) {
-        name = visitValidIdentifier(ctx->arraySizedInner()->validIdentifier()).as<std::string>();
+        name = visitValidIdentifier(ctx->arraySizedInner()->validIdentifier());
         typeSymbol = visitTypeParameter(ctx->arraySizedInner()->typeParameter());
-        size = castAnyTo<AtomicExpression::Ptr, Constant::Ptr>(
-                visitPositiveConstant(ctx->arraySizedInner()->positiveConstant()))->getValue();
+        size = visitPositiveConstant(ctx->arraySizedInner()->positiveConstant())->getValue();
     } else {
-        name = visitValidIdentifier(ctx->arrayUnsizedInner()->validIdentifier()).as<std::string>();
+        name = visitValidIdentifier(ctx->arrayUnsizedInner()->validIdentifier());
         typeSymbol = visitTypeParameter(ctx->arrayUnsizedInner()->typeParameter());
     }
 
-    ArrayDeclaration::Ptr arrayDeclaration = std::make_shared<ArrayDeclaration>(ctx->getStart());
+    ArrayDeclaration::Ptr arrayDeclaration = makeNode<ArrayDeclaration>(ctx->getStart());
     ArraySymbol::Ptr arraySymbol = currentContext()->getSymbolTable()->addArrayDeclaration(
             ctx, typeSymbol->getType(), name, sized, size, arrayDeclaration);
     arrayDeclaration->setSymbol(arraySymbol);
 
-    return castTo<Statement::Ptr>(arrayDeclaration);
+    return arrayDeclaration;
 }
 
-antlrcpp::Any ASTVisitor::visitArrayDefinition(CaramelParser::ArrayDefinitionContext *ctx) {
-    logger.trace() << "visiting array definition: " << grey <<ctx->getText();
+ArrayDefinition::Ptr ASTVisitor::visitArrayDefinition(CaramelParser::ArrayDefinitionContext *ctx) {
+    CARAMEL_TRACE << "visiting array definition: " << grey <<ctx->getText();
 
     bool sized = ctx->arraySizedInner() != nullptr;
     size_t size = {};
@@ -75,19 +74,18 @@ antlrcpp::Any ASTVisitor::visitArrayDefinition(CaramelParser::ArrayDefinitionCon
     TypeSymbol::Ptr typeSymbol;
 
     if (sized) {
-        name = visitValidIdentifier(ctx->arraySizedInner()->validIdentifier()).as<std::string>();
+        name = visitValidIdentifier(ctx->arraySizedInner()->validIdentifier());
         typeSymbol = visitTypeParameter(ctx->arraySizedInner()->typeParameter());
-        size = castAnyTo<AtomicExpression::Ptr, Constant::Ptr>(
-                visitPositiveConstant(ctx->arraySizedInner()->positiveConstant()))->getValue();
+        size = visitPositiveConstant(ctx->arraySizedInner()->positiveConstant())->getValue();
     } else {
-        name = visitValidIdentifier(ctx->arrayUnsizedInner()->validIdentifier()).as<std::string>();
+        name = visitValidIdentifier(ctx->arrayUnsizedInner()->validIdentifier());
         typeSymbol = visitTypeParameter(ctx->arrayUnsizedInner()->typeParameter());
     }
 
     bool hasBlock = ctx->arrayBlock() != nullptr;
     std::vector<Expression::Ptr> content;
     if (hasBlock) {
-        content = std::move(visitArrayBlock(ctx->arrayBlock()).as<std::vector<Expression::Ptr>>());
+        content = visitArrayBlock(ctx->arrayBlock());
 
         if (sized && size < content.size()) {
                 throw ArrayBlockSizeExceedsDeclarationException(
@@ -106,16 +104,16 @@ antlrcpp::Any ASTVisitor::visitArrayDefinition(CaramelParser::ArrayDefinitionCon
         content.push_back(Constant::defaultConstant(ctx->getStart()));
     }
 
-    ArrayDefinition::Ptr arrayDefinition = std::make_shared<ArrayDefinition>(ctx->getStart());
+    ArrayDefinition::Ptr arrayDefinition = makeNode<ArrayDefinition>(ctx->getStart());
     ArraySymbol::Ptr arraySymbol = currentContext()->getSymbolTable()->addArrayDefinition(
             ctx, typeSymbol->getType(), name, std::move(content), arrayDefinition);
     arrayDefinition->setSymbol(arraySymbol);
 
-    return castTo<Statement::Ptr>(arrayDefinition);
+    return arrayDefinition;
 }
 
-antlrcpp::Any ASTVisitor::visitArrayBlock(CaramelParser::ArrayBlockContext *ctx) {
-    logger.trace() << "visiting array block: " << grey <<ctx->getText();
+std::vector<Expression::Ptr> ASTVisitor::visitArrayBlock(CaramelParser::ArrayBlockContext *ctx) {
+    CARAMEL_TRACE << "visiting array block: " << grey <<ctx->getText();
 
     std::vector<Expression::Ptr> expressions;
     for (auto expression : ctx->expressionNoComma()) {
@@ -38,22 +38,22 @@ using namespace caramel::colors;
 using namespace caramel::visitors;
 
 
-antlrcpp::Any ASTVisitor::visitControlBlock(CaramelParser::ControlBlockContext *ctx) {
-    logger.trace() << "visiting control block: " << grey <<ctx->getText();
+ControlBlock::Ptr ASTVisitor::visitControlBlock(CaramelParser::ControlBlockContext *ctx) {
+    CARAMEL_TRACE << "visiting control block: " << grey <<ctx->getText();
 
     if (ctx->ifBlock()) {
-        return castAnyTo<IfBlock::Ptr, ControlBlock::Ptr>(visitIfBlock(ctx->ifBlock()));
+        return visitIfBlock(ctx->ifBlock());
     } else if (ctx->whileBlock()) {
-        return castAnyTo<WhileBlock::Ptr, ControlBlock::Ptr>(visitWhileBlock(ctx->whileBlock()));
+        return visitWhileBlock(ctx->whileBlock());
     } else if (ctx->doWhileBlock()) {
-        return castAnyTo<Do_WhileBlock::Ptr, ControlBlock::Ptr>(visitDoWhileBlock(ctx->doWhileBlock()));
+        return visitDoWhileBlock(ctx->doWhileBlock());
     } else { // if (ctx->forBlock()) {
-        return castAnyTo<ForBlock::Ptr, ControlBlock::Ptr>(visitForBlock(ctx->forBlock()));
+        return visitForBlock(ctx->forBlock());
     }
 }
 
-antlrcpp::Any ASTVisitor::visitIfBlock(CaramelParser::IfBlockContext *ctx) {
-    logger.trace() << "visiting if block: " << grey <<ctx->getText();
+IfBlock::Ptr ASTVisitor::visitIfBlock(CaramelParser::IfBlockContext *ctx) {
+    CARAMEL_TRACE << "visiting if block: " << grey <<ctx->getText();
 
     IfBlock::Ptr ifBlock;
     Expression::Ptr expression = visitExpression(ctx->expression());
@@ -63,45 +63,44 @@ antlrcpp::Any ASTVisitor::visitIfBlock(CaramelParser::IfBlockContext *ctx) {
     if (ctx->block().size() > 1) {
         logger.trace() << "visit else :";
         std::vector<Statement::Ptr> elseBlock = visitBlock(ctx->block(1));
-        ifBlock = std::make_shared<IfBlock>(expression, thenBlock, elseBlock, ctx->start);
+        ifBlock = makeNode<IfBlock>(expression, thenBlock, elseBlock, ctx->start);
     } else if (nullptr != ctx->ifBlock()) {
         logger.trace() << "visit else if :";
-        Statement::Ptr elseIfBlock = std::dynamic_pointer_cast<Statement>(
-                visitIfBlock(ctx->ifBlock()).as<IfBlock::Ptr>());
+        Statement::Ptr elseIfBlock = visitIfBlock(ctx->ifBlock());
         std::vector<Statement::Ptr> elseIfBlockVector;
         elseIfBlockVector.push_back(elseIfBlock);
-        ifBlock = std::make_shared<IfBlock>(expression, thenBlock, elseIfBlockVector, ctx->start);
+        ifBlock = makeNode<IfBlock>(expression, thenBlock, elseIfBlockVector, ctx->start);
     } else {
-        ifBlock = std::make_shared<IfBlock>(expression, thenBlock, std::vector<Statement::Ptr>(), ctx->start);
+        ifBlock = makeNode<IfBlock>(expression, thenBlock, std::vector<Statement::Ptr>(), ctx->start);
     }
 
     return ifBlock;
 }
 
-antlrcpp::Any ASTVisitor::visitWhileBlock(CaramelParser::WhileBlockContext *ctx) {
-    logger.trace() << "visiting while block: " << grey <<ctx->getText();
+WhileBlock::Ptr ASTVisitor::visitWhileBlock(CaramelParser::WhileBlockContext *ctx) {
+    CARAMEL_TRACE << "visiting while block: " << grey <<ctx->getText();
 
     Expression::Ptr expression = visitExpression(ctx->expression());
     logger.trace() << "while condition :";
     std::vector<Statement::Ptr> block = visitBlock(ctx->block());
 
-    WhileBlock::Ptr whileBlock = std::make_shared<WhileBlock>(expression, block, ctx->start);
+    WhileBlock::Ptr whileBlock = makeNode<WhileBlock>(expression, block, ctx->start);
     return whileBlock;
 }
 
-antlrcpp::Any ASTVisitor::visitDoWhileBlock(CaramelParser::DoWhileBlockContext *ctx) {
-    logger.trace() << "visiting do while block: " << grey <<ctx->getText();
+Do_WhileBlock::Ptr ASTVisitor::visitDoWhileBlock(CaramelParser::DoWhileBlockContext *ctx) {
+    CARAMEL_TRACE << "visiting do while block: " << grey <<ctx->getText();
 
     Expression::Ptr expression = visitExpression(ctx->expression());
     logger.trace() << "do while condition :";
     std::vector<Statement::Ptr> block = visitBlock(ctx->block());
 
-    Do_WhileBlock::Ptr doWhileBlock = std::make_shared<Do_WhileBlock>(expression, block, ctx->start);
+    Do_WhileBlock::Ptr doWhileBlock = makeNode<Do_WhileBlock>(expression, block, ctx->start);
     return doWhileBlock;
 }
 
-antlrcpp::Any ASTVisitor::visitForBlock(CaramelParser::ForBlockContext *ctx) {
-    logger.trace() << "visiting for block: " << grey <<ctx->getText();
+ForBlock::Ptr ASTVisitor::visitForBlock(CaramelParser::ForBlockContext *ctx) {
+    CARAMEL_TRACE << "visiting for block: " << grey <<ctx->getText();
 
     Expression::Ptr begin = visitExpression(ctx->expression(0));
     Expression::Ptr end = visitExpression(ctx->expression(1));
@@ -109,6 +108,6 @@ antlrcpp::Any ASTVisitor::visitForBlock(CaramelParser::ForBlockContext *ctx) {
     logger.trace() << "for condition :";
     std::vector<Statement::Ptr> block = visitBlock(ctx->block());
 
-    ForBlock::Ptr forBlock = std::make_shared<ForBlock>(begin, end, step, block, ctx->start);
+    ForBlock::Ptr forBlock = makeNode<ForBlock>(begin, end, step, block, ctx->start);
     return forBlock;
 }
@@ -34,34 +34,36 @@ using namespace caramel::utils;
 using namespace caramel::colors;
 using namespace caramel::visitors;
 
-antlrcpp::Any
+FunctionDeclaration::Ptr
 ASTVisitor::visitFunctionDeclaration(CaramelParser::FunctionDeclarationContext *ctx) {
-    logger.trace() << "Visiting function declaration: " << grey << ctx->getText();
+    CARAMEL_TRACE << "Visiting function declaration: " << grey << ctx->getText();
 
     auto innerCtx = ctx->functionDeclarationInner();
 
-    PrimaryType::Ptr returnType = visitTypeParameter(innerCtx->typeParameter()).as<TypeSymbol::Ptr>()->getType();
+    PrimaryType::Ptr returnType = visitTypeParameter(innerCtx->typeParameter())->getType();
     std::string name = visitValidIdentifier(innerCtx->validIdentifier());
     std::vector<FunctionParameterSignature> params =
             visitFunctionArguments(innerCtx->functionArguments());
-    FunctionDeclaration::Ptr functionDeclaration = std::make_shared<FunctionDeclaration>(innerCtx->start);
+    FunctionDeclaration::Ptr functionDeclaration = makeNode<FunctionDeclaration>(innerCtx->start);
     FunctionSymbol::Ptr functionSymbol = rootContext()->getSymbolTable()->addFunctionDeclaration(
             innerCtx, returnType, name, params, functionDeclaration);
     functionDeclaration->setFunctionSymbol(functionSymbol);
 
-    auto traceLogger = logger.trace();
-    traceLogger << "New function declared " << name << " with return type " << returnType->getIdentifier();
-    for (auto const &[paramName, paramType, paramSymbolType] : params) {
-        traceLogger << "\n\t- param: " << paramName << " as " << paramType->getIdentifier()
-                    << " (" << paramSymbolType << ")";
+    if (logger.isEnabled(TRACE)) {
+        auto traceLogger = logger.trace();
+        traceLogger << "New function declared " << name << " with return type " << returnType->getIdentifier();
+        for (auto const &[paramName, paramType, paramSymbolType] : params) {
+            traceLogger << "\n\t- param: " << paramName << " as " << paramType->getIdentifier()
+                        << " (" << paramSymbolType << ")";
+        }
+        traceLogger.show();
     }
-    traceLogger.show();
 
-    return castTo<Statement::Ptr>(functionDeclaration);
+    return functionDeclaration;
 }
 
-antlrcpp::Any ASTVisitor::visitFunctionDefinition(CaramelParser::FunctionDefinitionContext *ctx) {
-    logger.trace() << "Visiting function definition: " << grey << ctx->getText();
+FunctionDefinition::Ptr ASTVisitor::visitFunctionDefinition(CaramelParser::FunctionDefinitionContext *ctx) {
+    CARAMEL_TRACE << "Visiting function definition: " << grey << ctx->getText();
 
     Context::Ptr parentContext = currentContext();
     ContextPusher contextPusher(*this);
@@ -74,7 +76,7 @@ antlrcpp::Any ASTVisitor::visitFunctionDefinition(CaramelParser::FunctionDefinit
 
     auto innerCtx = ctx->functionDeclarationInner();
 
-    PrimaryType::Ptr returnType = visitTypeParameter(innerCtx->typeParameter()).as<TypeSymbol::Ptr>()->getType();
+    PrimaryType::Ptr returnType = visitTypeParameter(innerCtx->typeParameter())->getType();
     std::string name = visitValidIdentifier(innerCtx->validIdentifier());
     std::vector<FunctionParameterSignature> params =
             visitFunctionArguments(innerCtx->functionArguments());
@@ -85,7 +87,7 @@ antlrcpp::Any ASTVisitor::visitFunctionDefinition(CaramelParser::FunctionDefinit
                 ctx, paramName, paramType, paramSymbolType));
     }
 
-    FunctionDefinition::Ptr functionDefinition = std::make_shared<FunctionDefinition>(functionContext, innerCtx->start);
+    FunctionDefinition::Ptr functionDefinition = makeNode<FunctionDefinition>(functionContext, innerCtx->start);
     FunctionSymbol::Ptr functionSymbol = parentContext->getSymbolTable()->addFunctionDefinition(
             innerCtx, functionContext, returnType, name, paramsSymbols, functionDefinition
     );
@@ -97,11 +99,11 @@ antlrcpp::Any ASTVisitor::visitFunctionDefinition(CaramelParser::FunctionDefinit
 
     functionContext->addStatements(visitBlock(ctx->block()));
 
-    return castTo<Statement::Ptr>(functionDefinition);
+    return functionDefinition;
 }
 
-antlrcpp::Any ASTVisitor::visitFunctionArguments(CaramelParser::FunctionArgumentsContext *ctx) {
-    logger.trace() << "Visiting named arguments: " << grey << ctx->getText();
+std::vector<FunctionParameterSignature> ASTVisitor::visitFunctionArguments(CaramelParser::FunctionArgumentsContext *ctx) {
+    CARAMEL_TRACE << "Visiting named arguments: " << grey << ctx->getText();
 
     std::vector<FunctionParameterSignature> params;
     for (auto argument : ctx->functionArgument()) {
@@ -111,13 +113,13 @@ antlrcpp::Any ASTVisitor::visitFunctionArguments(CaramelParser::FunctionArgument
     return params;
 }
 
-antlrcpp::Any ASTVisitor::visitFunctionArgument(CaramelParser::FunctionArgumentContext *ctx) {
-    logger.trace() << "Visiting function argument: " << grey << ctx->getText();
+FunctionParameterSignature ASTVisitor::visitFunctionArgument(CaramelParser::FunctionArgumentContext *ctx) {
+    CARAMEL_TRACE << "Visiting function argument: " << grey << ctx->getText();
 
     // Get the optional name, or generate a unique one
     std::string name;
     if (ctx->validIdentifier()) {
-        name = visitValidIdentifier(ctx->validIdentifier()).as<std::string>();
+        name = visitValidIdentifier(ctx->validIdentifier());
     } else {
         std::stringstream nameSS;
         nameSS << "__unnamed_argument_" << ctx->start->getLine() << "_" << ctx->start->getCharPositionInLine() << "__";
@@ -34,39 +34,39 @@ using namespace caramel::utils;
 using namespace caramel::colors;
 using namespace caramel::visitors;
 
-antlrcpp::Any
+std::vector<Statement::Ptr>
 ASTVisitor::visitVariableDeclaration(CaramelParser::VariableDeclarationContext *ctx) {
-    logger.trace() << "visiting variable declaration: " << grey <<ctx->getText();
+    CARAMEL_TRACE << "visiting variable declaration: " << grey <<ctx->getText();
 
-    TypeSymbol::Ptr typeSymbol = visitTypeParameter(ctx->typeParameter()).as<TypeSymbol::Ptr>();
+    TypeSymbol::Ptr typeSymbol = visitTypeParameter(ctx->typeParameter());
     std::vector<Statement::Ptr> variables;
     for (auto validIdentifierCtx : ctx->validIdentifier()) {
         std::string name = visitValidIdentifier(validIdentifierCtx);
-        VariableSymbol::Ptr variableSymbol = std::make_shared<VariableSymbol>(name, typeSymbol);
+        VariableSymbol::Ptr variableSymbol = makeNode<VariableSymbol>(name, typeSymbol);
 
-        VariableDeclaration::Ptr variableDeclaration = std::make_shared<VariableDeclaration>(variableSymbol,
+        VariableDeclaration::Ptr variableDeclaration = makeNode<VariableDeclaration>(variableSymbol,
                                                                                              validIdentifierCtx->getStart());
         variables.push_back(variableDeclaration);
 
-        currentContext()->getSymbolTable()->addVariableDeclaration(ctx, typeSymbol->getType(), name,
-                                                                   variableDeclaration);
+        variableDeclaration->setVariableSymbol(currentContext()->getSymbolTable()->addVariableDeclaration(
+                ctx, typeSymbol->getType(), name, variableDeclaration));
 
-        logger.trace() << "New variable declared " << name << " of type " << typeSymbol->getType()->getIdentifier();
+        CARAMEL_TRACE << "New variable declared " << name << " of type " << typeSymbol->getType()->getIdentifier();
     }
 
     return variables;
 }
 
-antlrcpp::Any ASTVisitor::visitVariableDefinition(CaramelParser::VariableDefinitionContext *ctx) {
-    logger.trace() << "visiting variable definition: " << grey <<ctx->getText();
+std::vector<Statement::Ptr> ASTVisitor::visitVariableDefinition(CaramelParser::VariableDefinitionContext *ctx) {
+    CARAMEL_TRACE << "visiting variable definition: " << grey <<ctx->getText();
 
-    TypeSymbol::Ptr typeSymbol = visitTypeParameter(ctx->typeParameter()).as<TypeSymbol::Ptr>();
+    TypeSymbol::Ptr typeSymbol = visitTypeParameter(ctx->typeParameter());
     std::vector<Statement::Ptr> variables;
     for (auto varDefValue : ctx->validIdentifier()) {
         std::string name = visitValidIdentifier(varDefValue);
         logger.trace() << "New variable declared: '" << name << "' with default value";
 
-        VariableDefinition::Ptr variableDef = std::make_shared<VariableDefinition>(varDefValue->getStart());
+        VariableDefinition::Ptr variableDef = makeNode<VariableDefinition>(varDefValue->getStart());
         variables.push_back(variableDef);
 
         VariableSymbol::Ptr variableSymbol = currentContext()->getSymbolTable()->addVariableDefinition(
@@ -77,10 +77,10 @@ antlrcpp::Any ASTVisitor::visitVariableDefinition(CaramelParser::VariableDefinit
         std::string name = visitValidIdentifier(varWithValue->validIdentifier());
 
         Expression::Ptr expression = visitExpressionNoComma(varWithValue->expressionNoComma());
-        logger.trace() << "New variable declared: '" << grey << name << " = "
+        CARAMEL_TRACE << "New variable declared: '" << grey << name << " = "
                        << varWithValue->expressionNoComma()->getText();
 
-        VariableDefinition::Ptr variableDef = std::make_shared<VariableDefinition>(
+        VariableDefinition::Ptr variableDef = makeNode<VariableDefinition>(
                 expression, varWithValue->getStart());
         variables.push_back(variableDef);
 
@@ -0,0 +1,39 @@
+/*
+ * Multi-line comment.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+void printArray(int32_t array[], int32_t size) {
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        putchar('a' + array[i]);
+    }
+    putchar('\n');
+}
+
+int32_t main() {
+    int32_t i;
+    int32_t letter;
+    int32_t x = 3;
+
+    int32_t zeros[20];
+    int32_t constants[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    int32_t prefix[15] = {4, 3, 2, 1};
+    int32_t mixed[9] = {1, x, 2, x + 1, 3 * 2, 0, 0, x * x};
+    char letters[11] = {'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd'};
+
+    printArray(zeros, 20);
+    printArray(constants, 12);
+    printArray(prefix, 15);
+    printArray(mixed, 9);
+    for (i = 0; i < 11; i++) {
+        letter = letters[i];
+        putchar(letter);
+    }
+    putchar('\n');
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+/*
+ * Multi-line comment.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+int32_t main() {
+    int32_t i;
+    int32_t sum = 0;
+    int32_t small[3] = {7, 8, 9};
+    int32_t buffer[50000];
+
+    for (i = 0; i < 50000; i++) {
+        buffer[i] = i % 7;
+    }
+    buffer[49999] = small[2];
+    for (i = 0; i < 50000; i++) {
+        sum = sum + buffer[i];
+    }
+
+    putchar('0' + sum % 10);
+    putchar('0' + sum / 10 % 10);
+    putchar('0' + sum / 100 % 10);
+    putchar('0' + small[0]);
+    putchar('0' + small[1]);
+    putchar('\n');
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+/*
+ * Multi-line comment.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+extern int32_t declaredFirst;
+int32_t counter;
+int64_t total = 3 * 7 - 1;
+int32_t separator = '\n';
+int32_t digits[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+int32_t squares[8] = {0, 1, 4, 9, 16};
+int32_t buffer[16];
+int32_t shadowed = 5;
+int32_t declaredFirst = 4;
+
+void printNumber(int64_t n) {
+    if (n >= 10) {
+        printNumber(n / 10);
+    }
+    putchar(digits[n % 10]);
+}
+
+void count() {
+    counter++;
+}
+
+int32_t main() {
+    int32_t i;
+    int32_t shadowed = 1;
+
+    for (i = 0; i < 8; i++) {
+        squares[i] = i * i;
+        buffer[i] = squares[i] + 1;
+        count();
+    }
+    for (i = 0; i < 8; i++) {
+        printNumber(buffer[i]);
+        putchar(' ');
+    }
+    putchar(separator);
+
+    printNumber(counter);
+    putchar(separator);
+    printNumber(total);
+    putchar(separator);
+    printNumber(shadowed);
+    putchar(separator);
+    printNumber(declaredFirst);
+    putchar(separator);
+
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include <stdint.h>
+#include <stdio.h>
+
+int32_t initialized = 7;
+int32_t zeroed;
+int32_t table[4] = {1, 2, 3, 4};
+
+void writeGlobals();
+
+int32_t main() {
+    writeGlobals();
+    putchar('0' + initialized);
+    putchar('0' + zeroed);
+    putchar('0' + table[2]);
+    putchar('\n');
+    return 0;
+}
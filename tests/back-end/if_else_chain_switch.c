@@ -0,0 +1,51 @@
+/*
+ * Multi-line comment.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+int32_t main() {
+    int32_t i;
+    int32_t c;
+
+    for (i = -1; i < 8; i++) {
+        if (i == 0) {
+            c = 'a';
+        } else if (i == 1) {
+            c = 'b';
+        } else if (2 == i) {
+            c = 'c';
+        } else if (i == 1) {
+            c = 'x';
+        } else if (i == 4) {
+            c = 'e';
+        } else if (i == 6) {
+            putchar('f');
+            c = 'g';
+        } else {
+            c = '.';
+        }
+        putchar(c);
+    }
+    putchar('\n');
+
+    for (i = 0; i < 1200; i += 100) {
+        if (i == 100) {
+            c = '1';
+        } else if (i == 300) {
+            c = '3';
+        } else if (i == 500) {
+            c = '5';
+        } else if (i == 700) {
+            c = '7';
+        } else if (i == 1100) {
+            c = 'B';
+        }
+        putchar(c);
+    }
+    putchar('\n');
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+#include <stdint.h>
+
+extern int32_t initialized;
+extern int32_t zeroed;
+extern int32_t table[4];
+
+void writeGlobals() {
+    initialized = 1;
+    zeroed = 2;
+    table[2] = 5;
+}
@@ -0,0 +1,42 @@
+/*
+ * Multi-line comment.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+int32_t main() {
+    int32_t i;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t flags[5] = {1, 0, 5, 0, 2};
+
+    for (i = 0; i < 3; i++) {
+        putchar('a' + i);
+    }
+    putchar('\n');
+
+    for (i = 2; i <= 22; i += 1) {
+        j = j + 1;
+        putchar('a' + i);
+    }
+    putchar('\n');
+    putchar('0' + j / 10);
+    putchar('0' + j % 10);
+    putchar('0' + i / 10);
+    putchar('0' + i % 10);
+    putchar('\n');
+
+    // The && splits the body in several blocks
+    for (i = 0; i < 3; i++) {
+        k = k + (flags[i] && 1);
+    }
+    for (i = 0; i < 5; i++) {
+        k = k + (flags[i] && i);
+    }
+    putchar('0' + k);
+    putchar('\n');
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+/*
+ * Multi-line comment.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+int32_t main() {
+    int32_t a[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    int32_t b[10] = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+    int32_t c[10] = {};
+    int32_t sum = 0;
+    int32_t i;
+
+    for (i = 0; i < 10; i++) {
+        c[i] = a[i] + b[i];
+    }
+    for (i = 0; i < 10; i++) {
+        putchar('0' + c[i]);
+    }
+    putchar('\n');
+
+    for (i = 1; i <= 9; ++i) {
+        c[i] ^= 3;
+    }
+    for (i = 0; i < 10; i++) {
+        putchar('0' + c[i]);
+    }
+    putchar('\n');
+
+    for (i = 0; i < 10; i++) {
+        sum += a[i];
+    }
+    putchar('0' + sum / 10);
+    putchar('0' + sum % 10);
+    putchar('\n');
+
+    return 0;
+}
@@ -40,16 +40,16 @@ def _info_completed_in_seconds(seconds: float):
 
 @trace
 def get_latest_grammar_file():
-    files = []
-    grammar_filename_regex = re.compile('Caramel_(v[0-9]+)\.g4')
+    files = {}
+    grammar_filename_regex = re.compile('Caramel_v([0-9]+)\.g4')
     for file in os.listdir('grammar/'):
         match = grammar_filename_regex.fullmatch(file)
         if match is not None:
-            files.append(file)
+            files[int(match.group(1))] = file
     if len(files) == 0:
         logger.critical('There is no grammar file in grammar/.')
         exit(1)
-    return sorted(files)[-1]
+    return files[max(files)]
 
 
 @trace
@@ -102,6 +102,13 @@ def _chef():
     test_common(parser_test_programs)
     parser_test_programs.add_argument('-d', '--debug', help='run Caramel as debug', action='store_true')
 
+    # Create the parser for the "test parsers" command
+    parser_test_parsers = test_subparsers.add_parser(
+        'parsers', help='Compare the hand-written front-end with the ANTLR one.')
+    parser_test_parsers.set_defaults(func=tools.test.test_parsers)
+    test_common(parser_test_parsers)
+    parser_test_parsers.add_argument('-d', '--debug', help='run Caramel as debug', action='store_true')
+
     # Create the parser for the "test all" command
     parser_test_all = test_subparsers.add_parser('all', help='Run all tests.')
     parser_test_all.set_defaults(func=tools.test.test_all)
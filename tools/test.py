@@ -221,7 +221,10 @@ class BackendTest(Test):
 
         # Get the GCC outputs
         gcc_flags = '-O0 -mno-red-zone -Wno-implicit-function-declaration'  # -Wall -Wextra -Wpedantic'
-        gcc_build_command = 'gcc {} {} -o ./build/cpp-bin/gcc.out'.format(gcc_flags, self.full_path)
+        # A file with the same name in linked/ is another translation unit to link the test with
+        linked_path = os.path.join(os.path.dirname(self.full_path), 'linked', self.name)
+        linked_file = linked_path if len(self.full_path) != 0 and os.path.isfile(linked_path) else ''
+        gcc_build_command = 'gcc {} {} {} -o ./build/cpp-bin/gcc.out'.format(gcc_flags, self.full_path, linked_file)
         gcc_run_command = './build/cpp-bin/gcc.out'
         logger.trace('GCC build command:', gcc_build_command)
         exec_(gcc_build_command)
@@ -241,7 +244,8 @@ class BackendTest(Test):
 
         # Get the Caramel outputs
         compile_command = './Caramel --good-defaults {}'.format(os.path.join('../..', self.full_path))
-        assemble_command = 'gcc ./assembly.s -no-pie -o ./caramel.out'
+        assemble_command = 'gcc ./assembly.s {} -no-pie -o ./caramel.out'.format(
+            os.path.join('../..', linked_file) if linked_file else '')
         run_command = './caramel.out'
 
         # Compile with Caramel
@@ -362,6 +366,64 @@ class BackendTest(Test):
         os.chdir(initial_cwd)
 
 
+class ParserTest(Test):
+    """Compiles a file with both front-ends, and expects the same diagnostics and return code."""
+
+    def _run(self, command):
+        with subprocess.Popen(
+                shlex.split(command),
+                stdout=subprocess.PIPE,
+                stderr=subprocess.PIPE,
+                env={'LD_LIBRARY_PATH': 'lib'}
+        ) as test_process:
+            test_process.wait()
+            out_str = list(map(lambda s: s.decode("utf-8"), test_process.stdout.readlines()))
+            error_str = list(map(lambda s: s.decode("utf-8"), test_process.stderr.readlines()))
+            return test_process.returncode, ''.join(out_str), ''.join(error_str)
+
+    @trace
+    def execute(self, open_gui=False, open_gui_on_failure=False, show_stdout=False, show_stderr=False):
+        start_time = time()
+
+        command = './build/cpp-bin/Caramel {}'.format(self.full_path)
+        logger.trace('Test command:', command)
+        antlr_result = self._run(command)
+        handwritten_result = self._run(command + ' --handwritten-parser')
+
+        self.state = {
+            'antlr': antlr_result,
+            'handwritten': handwritten_result,
+            'time': time() - start_time
+        }
+        self.succeeded = antlr_result == handwritten_result
+
+        if self.succeeded:
+            logger.info(
+                'Test {}'.format(self.name),
+                colored('succeeded.', color='green', attrs=['bold']),
+                colored('[%s]' % seconds_to_string(self.state['time']), color='yellow')
+            )
+        else:
+            logger.info(
+                'Test {}'.format(self.name),
+                colored('failed #{} instead of #{}.'.format(_return_code_to_str(handwritten_result[0]),
+                                                           _return_code_to_str(antlr_result[0])),
+                        color='red', attrs=['bold']),
+                colored('[%s]' % seconds_to_string(self.state['time']), color='yellow')
+            )
+            failed_tests.append(self.name)
+
+        # Show stdout or stderr of both front-ends if asked
+        for front_end in ['antlr', 'handwritten']:
+            _, out_str, error_str = self.state[front_end]
+            if show_stdout or (not self.succeeded and out_str != self.state['antlr'][1]):
+                print('\n'.join(['#' * 20, colored('{} stdout output:'.format(front_end), attrs=['bold']),
+                                 out_str, '-' * 20]))
+            if show_stderr or (not self.succeeded and error_str != self.state['antlr'][2]):
+                print('\n'.join(['#' * 20, colored('{} stderr output:'.format(front_end), attrs=['bold']),
+                                 error_str, '-' * 20]))
+
+
 class Tests:
     def __init__(self):
         self.tests = []
@@ -394,7 +456,7 @@ class Tests:
         nb_tests_before = len(self.tests)
         for test_directory in ['.'] + list(sorted(os.listdir(base_directory))):
             logger.debug('Looking for tests in:', test_directory)
-            if os.path.isdir(os.path.join(base_directory, test_directory)):
+            if test_directory != 'linked' and os.path.isdir(os.path.join(base_directory, test_directory)):
                 for test_file in sorted(os.listdir(os.path.join(base_directory, test_directory))):
                     if only is None or test_file in only:
                         if only is not None:
@@ -451,6 +513,16 @@ class BackendTests(Tests):
         logger.debug('Added back-end test {}.'.format(name))
 
 
+class ParserTests(Tests):
+    def __init__(self):
+        super().__init__()
+
+    @trace
+    def add_test(self, name: str, full_path, should_fail: bool):
+        self.tests.append(ParserTest(name, full_path, should_fail))
+        logger.debug('Added parser test {}.'.format(name))
+
+
 @trace
 def print_failed_tests():
     if len(failed_tests) > 0:
@@ -587,6 +659,34 @@ def test_programs(args):
     print_failed_tests()
 
 
+@trace
+def test_parsers(args):
+    logger.info('Comparing the ANTLR and the hand-written front-ends...')
+
+    if args.build:
+        from tools.build import build_grammar, build_caramel
+        build_grammar(args)
+        build_caramel(args)
+
+    if args.all:
+        args.test_files = None
+
+    # Run the given files, or all the grammar and semantic tests, through both front-ends
+    parser_tests = ParserTests()
+    if args.test_files:
+        for test_path in args.test_files:
+            parser_tests.add_test(test_path.split('/')[-1], test_path, False)
+    else:
+        parser_tests.discover(PATHS['grammar-test-dir'])
+        parser_tests.discover(PATHS['semantic-test-dir'])
+    parser_tests.run_all(
+        show_stdout=args.stdout,
+        show_stderr=args.stderr,
+    )
+
+    print_failed_tests()
+
+
 @trace
 def test_all(args):
     logger.info('Running all tests...')